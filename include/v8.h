@@ -89,6 +89,7 @@ class NumberObject;
 class Object;
 class ObjectOperationDescriptor;
 class ObjectTemplate;
+class OutputStream;
 class Platform;
 class Primitive;
 class Promise;
@@ -148,6 +149,8 @@ class HeapObject;
 class Isolate;
 class Object;
 struct StreamedSource;
+struct PreparedCodeCache;
+class JsonTape;
 template<typename T> class CustomArguments;
 class PropertyCallbackArguments;
 class FunctionCallbackArguments;
@@ -1214,6 +1217,40 @@ class V8_EXPORT ScriptCompiler {
     CachedData* cached_data;
   };
 
+  /**
+   * A persistent store for code cache data, implemented by the embedder and
+   * passed to V8 in Isolate::CreateParams. Scripts that are not found in the
+   * isolate's compilation cache are looked up in the store by a key computed
+   * from the script source and origin, and the code of newly compiled scripts
+   * is added to it. Regular expressions are stored the same way, keyed by
+   * their source and flags, once their code has been compiled. A store may be
+   * shared by several isolates, so its methods can be called on different
+   * threads.
+   */
+  class V8_EXPORT CodeCacheBackingStore {
+   public:
+    virtual ~CodeCacheBackingStore() {}
+
+    /**
+     * Returns the data stored under |key|, or NULL if there is none. The data
+     * has to stay valid until it is passed to Release.
+     */
+    virtual const CachedData* Lookup(uint64_t key) = 0;
+
+    /**
+     * Called when V8 no longer needs data returned by Lookup. |rejected| is
+     * true if the data could not be used, e.g. because it was produced by a
+     * different V8 version or with different flags.
+     */
+    virtual void Release(const CachedData* data, bool rejected) = 0;
+
+    /**
+     * Stores |length| bytes of code cache data under |key|. The data is only
+     * valid during the call.
+     */
+    virtual void Store(uint64_t key, const uint8_t* data, int length) = 0;
+  };
+
   /**
    * For streaming incomplete script data to V8. The embedder should implement a
    * subclass of this class.
@@ -1298,6 +1335,43 @@ class V8_EXPORT ScriptCompiler {
     virtual void Run() = 0;
   };
 
+  /**
+   * Code cache data which is checked and prepared for consumption on a
+   * background thread (see ConsumeCodeCacheTask below). It can be used to
+   * compile its script once the task has been run.
+   */
+  class V8_EXPORT PreparedCodeCache {
+   public:
+    // Takes ownership of |cached_data|.
+    explicit PreparedCodeCache(CachedData* cached_data);
+    ~PreparedCodeCache();
+
+    // Ownership of the CachedData is *not* transferred to the caller. The
+    // rejected flag is set once the data has been checked, either by the task
+    // or when compiling.
+    const CachedData* GetCachedData() const;
+
+    internal::PreparedCodeCache* impl() const { return impl_; }
+
+   private:
+    // Prevent copying. Not implemented.
+    PreparedCodeCache(const PreparedCodeCache&);
+    PreparedCodeCache& operator=(const PreparedCodeCache&);
+
+    internal::PreparedCodeCache* impl_;
+  };
+
+  /**
+   * A task which the embedder can run on a background thread to check code
+   * cache data before it is consumed. Returned by
+   * ScriptCompiler::StartConsumingCodeCache.
+   */
+  class ConsumeCodeCacheTask {
+   public:
+    virtual ~ConsumeCodeCacheTask() {}
+    virtual void Run() = 0;
+  };
+
   enum CompileOptions {
     kNoCompileOptions = 0,
     kProduceParserCache,
@@ -1377,6 +1451,30 @@ class V8_EXPORT ScriptCompiler {
       Local<Context> context, StreamedSource* source,
       Local<String> full_source_string, const ScriptOrigin& origin);
 
+  /**
+   * Returns a task which checks the code cache data of |cache| for
+   * consumption, or NULL if the data cannot be consumed by this isolate. The
+   * task does not touch the isolate's heap. The user is responsible for
+   * running the task on a background thread and deleting it. Only the
+   * deserialization into the heap remains to be done by CompileUnboundScript
+   * below.
+   */
+  static ConsumeCodeCacheTask* StartConsumingCodeCache(
+      Isolate* isolate, PreparedCodeCache* cache);
+
+  /**
+   * Compiles the specified script (context-independent) from code cache data
+   * which has been prepared by a ConsumeCodeCacheTask. If the task has not
+   * been run, the data is checked on the calling thread. If the data is
+   * rejected, the script is compiled from source.
+   *
+   * This must not be called while the ConsumeCodeCacheTask is running. Call
+   * it after ConsumeCodeCacheTask::Run has returned, or without ever having
+   * started the task.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<UnboundScript> CompileUnboundScript(
+      Isolate* isolate, Source* source, PreparedCodeCache* cache);
+
   /**
    * Return a version tag for CachedData for the current V8 version & flags.
    *
@@ -1435,7 +1533,8 @@ class V8_EXPORT ScriptCompiler {
 
  private:
   static V8_WARN_UNUSED_RESULT MaybeLocal<UnboundScript> CompileUnboundInternal(
-      Isolate* isolate, Source* source, CompileOptions options, bool is_module);
+      Isolate* isolate, Source* source, CompileOptions options, bool is_module,
+      PreparedCodeCache* prepared_code_cache = NULL);
 };
 
 
@@ -1656,7 +1755,7 @@ struct SampleInfo {
 
 
 /**
- * A JSON Parser.
+ * A JSON Parser and Stringifier.
  */
 class V8_EXPORT JSON {
  public:
@@ -1671,6 +1770,93 @@ class V8_EXPORT JSON {
                        Local<Value> Parse(Local<String> json_string));
   static V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(
       Isolate* isolate, Local<String> json_string);
+
+  /**
+   * JSON text which can be tokenized and validated on a background thread
+   * (see ParseTask below). The characters are not copied and must be kept
+   * alive, together with the PreparedSource, until it has been parsed.
+   */
+  class V8_EXPORT PreparedSource {
+   public:
+    // Latin1 characters.
+    PreparedSource(const uint8_t* data, int length);
+    // UTF-16 code units.
+    PreparedSource(const uint16_t* data, int length);
+    ~PreparedSource();
+
+    /**
+     * Makes a running ParseTask return early. Can be called from any thread.
+     * A cancelled source cannot be parsed anymore.
+     */
+    void Cancel();
+
+    internal::JsonTape* impl() const { return impl_; }
+
+   private:
+    // Prevent copying. Not implemented.
+    PreparedSource(const PreparedSource&);
+    PreparedSource& operator=(const PreparedSource&);
+
+    internal::JsonTape* impl_;
+  };
+
+  /**
+   * A task which the embedder can run on a background thread to do most of
+   * the work of parsing a PreparedSource. Returned by JSON::StartParsing.
+   */
+  class ParseTask {
+   public:
+    virtual ~ParseTask() {}
+    virtual void Run() = 0;
+  };
+
+  /**
+   * Returns a task which tokenizes and validates |source| without touching
+   * the heap. The user is responsible for running the task on a background
+   * thread and deleting it.
+   */
+  static ParseTask* StartParsing(Isolate* isolate, PreparedSource* source);
+
+  /**
+   * Creates the value described by |source|. If no ParseTask has been run for
+   * it, the source is tokenized on the calling thread first. Returns an empty
+   * handle without throwing if the source has been cancelled.
+   *
+   * This must not be called while a ParseTask for |source| is running. Call
+   * it after ParseTask::Run has returned, or without ever having started the
+   * task. To stop a running task early, use PreparedSource::Cancel and wait
+   * for Run to return.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(Isolate* isolate,
+                                                       PreparedSource* source);
+
+  /**
+   * Serializes |json_object| like JSON.stringify without replacer and gap
+   * would, but writes the result as UTF-8 directly into |buffer| instead of
+   * creating a string. Orphan surrogates are replaced with U+FFFD. The output
+   * is not null-terminated.
+   *
+   * \return The length of the complete output in bytes. If it is larger than
+   *   |capacity|, only as many complete characters as fit have been written.
+   *   Zero if |json_object| has no JSON representation (e.g. undefined), and
+   *   Nothing if an exception has been thrown.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<size_t> StringifyToUtf8(
+      Local<Context> context, Local<Value> json_object, char* buffer,
+      size_t capacity);
+
+  /**
+   * Like StringifyToUtf8, but passes the UTF-8 output to |stream| in chunks
+   * of stream->GetChunkSize() bytes through WriteAsciiChunk, buffering no
+   * more than one chunk. Characters are not split across chunks. EndOfStream
+   * is called after the last chunk, also if there is no output, unless the
+   * stream has aborted or an exception has been thrown.
+   *
+   * \return The length of the complete output in bytes, zero if |json_object|
+   *   has no JSON representation, and Nothing if an exception has been thrown.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<size_t> Stringify(
+      Local<Context> context, Local<Value> json_object, OutputStream* stream);
 };
 
 
@@ -4033,7 +4219,11 @@ class V8_EXPORT RegExp : public Object {
     kIgnoreCase = 2,
     kMultiline = 4,
     kSticky = 8,
-    kUnicode = 16
+    kUnicode = 16,
+    // Match with an engine whose running time is linear in the length of
+    // the subject. Patterns with backreferences or lookarounds, unicode
+    // regexps and very large patterns ignore this flag.
+    kLinear = 32
   };
 
   /**
@@ -4925,6 +5115,15 @@ class V8_EXPORT ResourceConstraints {
   void set_code_range_size(size_t value) {
     code_range_size_ = value;
   }
+  int stub_cache_size() const { return stub_cache_size_; }
+  /**
+   * Sets the number of entries in the primary table of the cache used by
+   * megamorphic property accesses. The value is rounded up to a power of two
+   * and clamped to the supported range. Zero selects the default size.
+   * Isolates with a non-default size are not initialized from the startup
+   * snapshot, since the snapshot code depends on the size.
+   */
+  void set_stub_cache_size(int value) { stub_cache_size_ = value; }
 
  private:
   int max_semi_space_size_;
@@ -4932,6 +5131,7 @@ class V8_EXPORT ResourceConstraints {
   int max_executable_size_;
   uint32_t* stack_limit_;
   size_t code_range_size_;
+  int stub_cache_size_;
 };
 
 
@@ -5303,7 +5503,8 @@ class V8_EXPORT Isolate {
           counter_lookup_callback(NULL),
           create_histogram_callback(NULL),
           add_histogram_sample_callback(NULL),
-          array_buffer_allocator(NULL) {}
+          array_buffer_allocator(NULL),
+          code_cache_backing_store(NULL) {}
 
     /**
      * The optional entry_hook allows the host application to provide the
@@ -5351,6 +5552,13 @@ class V8_EXPORT Isolate {
      * store of ArrayBuffers.
      */
     ArrayBuffer::Allocator* array_buffer_allocator;
+
+    /**
+     * An optional persistent store for compiled scripts, see
+     * ScriptCompiler::CodeCacheBackingStore. The embedder owns the store and
+     * has to keep it alive as long as the isolate.
+     */
+    ScriptCompiler::CodeCacheBackingStore* code_cache_backing_store;
   };
 
 
@@ -7170,7 +7378,7 @@ class Internals {
   static const int kNodeIsPartiallyDependentShift = 4;
   static const int kNodeIsActiveShift = 4;
 
-  static const int kJSObjectType = 0xb5;
+  static const int kJSObjectType = 0xb6;
   static const int kFirstNonstringType = 0x80;
   static const int kOddballType = 0x83;
   static const int kForeignType = 0x87;
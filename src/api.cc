@@ -19,6 +19,7 @@
 #include "src/api-experimental.h"
 #include "src/api-natives.h"
 #include "src/assert-scope.h"
+#include "src/background-deserialization-task.h"
 #include "src/background-parsing-task.h"
 #include "src/base/functional.h"
 #include "src/base/platform/platform.h"
@@ -37,9 +38,12 @@
 #include "src/execution.h"
 #include "src/gdb-jit.h"
 #include "src/global-handles.h"
+#include "src/ic/stub-cache.h"
 #include "src/icu_util.h"
 #include "src/isolate-inl.h"
 #include "src/json-parser.h"
+#include "src/json-stringifier.h"
+#include "src/json-tape.h"
 #include "src/messages.h"
 #include "src/parsing/parser.h"
 #include "src/parsing/scanner-character-streams.h"
@@ -507,7 +511,8 @@ ResourceConstraints::ResourceConstraints()
       max_old_space_size_(0),
       max_executable_size_(0),
       stack_limit_(NULL),
-      code_range_size_(0) { }
+      code_range_size_(0),
+      stub_cache_size_(0) { }
 
 void ResourceConstraints::ConfigureDefaults(uint64_t physical_memory,
                                             uint64_t virtual_memory_limit) {
@@ -566,6 +571,7 @@ void SetResourceConstraints(i::Isolate* isolate,
     uintptr_t limit = reinterpret_cast<uintptr_t>(constraints.stack_limit());
     isolate->stack_guard()->SetStackLimit(limit);
   }
+  isolate->set_stub_cache_size(constraints.stub_cache_size());
 }
 
 
@@ -1599,6 +1605,19 @@ ScriptCompiler::StreamedSource::GetCachedData() const {
 }
 
 
+ScriptCompiler::PreparedCodeCache::PreparedCodeCache(CachedData* cached_data)
+    : impl_(new i::PreparedCodeCache(cached_data)) {}
+
+
+ScriptCompiler::PreparedCodeCache::~PreparedCodeCache() { delete impl_; }
+
+
+const ScriptCompiler::CachedData*
+ScriptCompiler::PreparedCodeCache::GetCachedData() const {
+  return impl_->cached_data.get();
+}
+
+
 Local<Script> UnboundScript::BindToCurrentContext() {
   i::Handle<i::HeapObject> obj =
       i::Handle<i::HeapObject>::cast(Utils::OpenHandle(this));
@@ -1718,7 +1737,7 @@ Local<UnboundScript> Script::GetUnboundScript() {
 
 MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
     Isolate* v8_isolate, Source* source, CompileOptions options,
-    bool is_module) {
+    bool is_module, PreparedCodeCache* prepared_code_cache) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
   PREPARE_FOR_EXECUTION_WITH_ISOLATE(
       isolate, "v8::ScriptCompiler::CompileUnbound()", UnboundScript);
@@ -1730,7 +1749,15 @@ MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
   }
 
   i::ScriptData* script_data = NULL;
-  if (options == kConsumeParserCache || options == kConsumeCodeCache) {
+  i::SerializedCodeData* prepared_data = NULL;
+  if (prepared_code_cache != NULL) {
+    DCHECK(options == kConsumeCodeCache);
+    // The data is owned by the prepared code cache, not by the source.
+    DCHECK(source->cached_data == NULL);
+    script_data = prepared_code_cache->impl()->script_data.get();
+    prepared_data = prepared_code_cache->impl()->serialized_data.get();
+    DCHECK_NOT_NULL(prepared_data);
+  } else if (options == kConsumeParserCache || options == kConsumeCodeCache) {
     DCHECK(source->cached_data);
     // ScriptData takes care of pointer-aligning the data.
     script_data = new i::ScriptData(source->cached_data->data,
@@ -1762,9 +1789,10 @@ MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
     result = i::Compiler::CompileScript(
         str, name_obj, line_offset, column_offset, source->resource_options,
         source_map_url, isolate->native_context(), NULL, &script_data, options,
-        i::NOT_NATIVES_CODE, is_module);
+        i::NOT_NATIVES_CODE, is_module, prepared_data);
     has_pending_exception = result.is_null();
-    if (has_pending_exception && script_data != NULL) {
+    if (has_pending_exception && script_data != NULL &&
+        prepared_code_cache == NULL) {
       // This case won't happen during normal operation; we have compiled
       // successfully and produced cached data, and but the second compilation
       // of the same source code fails.
@@ -1780,6 +1808,11 @@ MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
       source->cached_data = new CachedData(
           script_data->data(), script_data->length(), CachedData::BufferOwned);
       script_data->ReleaseDataOwnership();
+    } else if (prepared_code_cache != NULL) {
+      prepared_code_cache->impl()->cached_data->rejected =
+          script_data->rejected();
+      // The data stays owned by the prepared code cache.
+      script_data = NULL;
     } else if (options == kConsumeParserCache || options == kConsumeCodeCache) {
       source->cached_data->rejected = script_data->rejected();
     }
@@ -1795,6 +1828,30 @@ MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundScript(
 }
 
 
+MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundScript(
+    Isolate* v8_isolate, Source* source, PreparedCodeCache* cache) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i::PreparedCodeCache* prepared = cache->impl();
+  bool can_consume =
+      i::FLAG_serialize_toplevel && !isolate->debug()->is_loaded();
+  if (can_consume && !prepared->checked) {
+    // The task has not been run. Do its work on this thread instead.
+    i::BackgroundDeserializationTask task(prepared, isolate);
+    task.Run();
+  }
+  if (!can_consume || prepared->serialized_data.is_empty()) {
+    if (can_consume) {
+      isolate->counters()->code_cache_reject_reason()->AddSample(
+          prepared->rejection_reason);
+    }
+    prepared->cached_data->rejected = true;
+    return CompileUnboundInternal(v8_isolate, source, kNoCompileOptions, false);
+  }
+  return CompileUnboundInternal(v8_isolate, source, kConsumeCodeCache, false,
+                                cache);
+}
+
+
 Local<UnboundScript> ScriptCompiler::CompileUnbound(Isolate* v8_isolate,
                                                     Source* source,
                                                     CompileOptions options) {
@@ -1988,6 +2045,16 @@ ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreamingScript(
 }
 
 
+ScriptCompiler::ConsumeCodeCacheTask* ScriptCompiler::StartConsumingCodeCache(
+    Isolate* v8_isolate, PreparedCodeCache* cache) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  if (!i::FLAG_serialize_toplevel || isolate->debug()->is_loaded()) {
+    return NULL;
+  }
+  return new i::BackgroundDeserializationTask(cache->impl(), isolate);
+}
+
+
 MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
                                            StreamedSource* v8_source,
                                            Local<String> full_source_string,
@@ -2657,6 +2724,70 @@ Local<Value> JSON::Parse(Local<String> json_string) {
 }
 
 
+JSON::PreparedSource::PreparedSource(const uint8_t* data, int length)
+    : impl_(new i::JsonTape(data, length)) {}
+
+
+JSON::PreparedSource::PreparedSource(const uint16_t* data, int length)
+    : impl_(new i::JsonTape(data, length)) {}
+
+
+JSON::PreparedSource::~PreparedSource() { delete impl_; }
+
+
+void JSON::PreparedSource::Cancel() { impl_->Cancel(); }
+
+
+JSON::ParseTask* JSON::StartParsing(Isolate* v8_isolate,
+                                    PreparedSource* source) {
+  return new i::BackgroundJsonParsingTask(source->impl(), i::FLAG_stack_size);
+}
+
+
+MaybeLocal<Value> JSON::Parse(Isolate* v8_isolate, PreparedSource* source) {
+  auto isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i::JsonTape* tape = source->impl();
+  if (tape->cancelled()) return MaybeLocal<Value>();
+  if (tape->state() == i::JsonTape::kNotParsed) {
+    // No task has been run. Tokenize on this thread instead.
+    tape->Parse(isolate->stack_guard()->real_climit());
+  }
+  if (tape->state() == i::JsonTape::kCancelled) return MaybeLocal<Value>();
+  PREPARE_FOR_EXECUTION_WITH_ISOLATE(isolate, "JSON::Parse", Value);
+  Local<Value> result;
+  has_pending_exception =
+      !ToLocal<Value>(i::JsonTapeMaterializer::Materialize(isolate, tape),
+                      &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
+
+Maybe<size_t> JSON::StringifyToUtf8(Local<Context> context,
+                                    Local<Value> json_object, char* buffer,
+                                    size_t capacity) {
+  PREPARE_FOR_EXECUTION_PRIMITIVE(context, "JSON::StringifyToUtf8", size_t);
+  i::Utf8JsonStringifier stringifier(isolate, buffer, capacity);
+  Maybe<size_t> result =
+      stringifier.Stringify(Utils::OpenHandle(*json_object));
+  has_pending_exception = result.IsNothing();
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(size_t);
+  return result;
+}
+
+
+Maybe<size_t> JSON::Stringify(Local<Context> context, Local<Value> json_object,
+                              OutputStream* stream) {
+  PREPARE_FOR_EXECUTION_PRIMITIVE(context, "JSON::Stringify", size_t);
+  i::Utf8JsonStringifier stringifier(isolate, stream);
+  Maybe<size_t> result =
+      stringifier.Stringify(Utils::OpenHandle(*json_object));
+  has_pending_exception = result.IsNothing();
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(size_t);
+  return result;
+}
+
+
 // --- D a t a ---
 
 bool Value::FullIsUndefined() const {
@@ -6122,6 +6253,7 @@ REGEXP_FLAG_ASSERT_EQ(kIgnoreCase);
 REGEXP_FLAG_ASSERT_EQ(kMultiline);
 REGEXP_FLAG_ASSERT_EQ(kSticky);
 REGEXP_FLAG_ASSERT_EQ(kUnicode);
+REGEXP_FLAG_ASSERT_EQ(kLinear);
 #undef REGEXP_FLAG_ASSERT_EQ
 
 v8::RegExp::Flags v8::RegExp::GetFlags() const {
@@ -7184,12 +7316,19 @@ Isolate* Isolate::New(const Isolate::CreateParams& params) {
     v8_isolate->SetAddHistogramSampleFunction(
         params.add_histogram_sample_callback);
   }
+  isolate->set_code_cache_backing_store(params.code_cache_backing_store);
   SetResourceConstraints(isolate, params.constraints);
   // TODO(jochen): Once we got rid of Isolate::Current(), we can remove this.
   Isolate::Scope isolate_scope(v8_isolate);
-  if (params.entry_hook || !i::Snapshot::Initialize(isolate)) {
+  bool custom_stub_cache =
+      i::StubCache::PrimaryTableBitsForSize(isolate->stub_cache_size()) !=
+      i::StubCache::kDefaultPrimaryTableBits;
+  if (params.entry_hook || custom_stub_cache ||
+      !i::Snapshot::Initialize(isolate)) {
     // If the isolate has a function entry hook, it needs to re-build all its
     // code stubs with entry hooks embedded, so don't deserialize a snapshot.
+    // The same holds for a stub cache size other than the one the probing
+    // code in the snapshot was generated for.
     if (i::Snapshot::EmbedsScript(isolate)) {
       // If the snapshot embeds a script, we cannot initialize the isolate
       // without the snapshot as a fallback. This is unlikely to happen though.
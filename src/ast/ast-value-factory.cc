@@ -262,6 +262,10 @@ void AstValueFactory::Internalize(Isolate* isolate) {
     // Everything is already internalized.
     return;
   }
+  // Grow the string table once for all raw strings of this parse, instead of
+  // repeatedly while inserting them one by one.
+  StringTable::EnsureCapacityForBulkInsert(
+      isolate, static_cast<int>(string_table_.occupancy()));
   // Strings need to be internalized before values, because values refer to
   // strings.
   for (int i = 0; i < strings_.length(); ++i) {
@@ -853,6 +853,33 @@ void Scope::CollectNonLocals(HashMap* non_locals) {
 }
 
 
+bool Scope::CollectFreeVariables(Scope* boundary,
+                                 ZoneList<VariableProxy*>* free_variables) {
+  if (is_with_scope() || scope_calls_eval_) return false;
+  for (int i = 0; i < unresolved_.length(); i++) {
+    VariableProxy* proxy = unresolved_[i];
+    if (proxy->is_resolved()) continue;
+    const AstRawString* name = proxy->raw_name();
+    bool is_free = true;
+    for (Scope* scope = this; is_free; scope = scope->outer_scope()) {
+      if (scope->variables_.Lookup(name) != NULL ||
+          (scope->function_ != NULL &&
+           scope->function_->proxy()->raw_name() == name)) {
+        is_free = false;
+      }
+      if (scope == boundary) break;
+    }
+    if (is_free) free_variables->Add(proxy, zone_);
+  }
+  for (int i = 0; i < inner_scopes_.length(); i++) {
+    if (!inner_scopes_[i]->CollectFreeVariables(boundary, free_variables)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
 void Scope::ReportMessage(int start_position, int end_position,
                           MessageTemplate::Template message,
                           const AstRawString* arg) {
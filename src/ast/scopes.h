@@ -565,6 +565,14 @@ class Scope: public ZoneObject {
 
   void CollectNonLocals(HashMap* non_locals);
 
+  // Collects the unresolved variable proxies in this scope and its inner
+  // scopes that do not refer to a variable declared in any scope up to and
+  // including |boundary|. Returns false if that cannot be decided before
+  // scope analysis, i.e. if the scopes contain a with statement or an eval
+  // call.
+  bool CollectFreeVariables(Scope* boundary,
+                            ZoneList<VariableProxy*>* free_variables);
+
   // ---------------------------------------------------------------------------
   // Strict mode support.
   bool IsDeclared(const AstRawString* name) {
@@ -0,0 +1,42 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/background-deserialization-task.h"
+
+#include "src/flags.h"
+
+namespace v8 {
+namespace internal {
+
+BackgroundDeserializationTask::BackgroundDeserializationTask(
+    PreparedCodeCache* cache, Isolate* isolate)
+    : cache_(cache) {
+  // The values the data is checked against depend on the isolate and on lazily
+  // computed state, so they are computed here rather than on the background
+  // thread.
+  cache->expected_magic_number = SerializedCodeData::ComputeMagicNumber(
+      ExternalReferenceTable::instance(isolate));
+  cache->expected_flag_hash = FlagList::Hash();
+}
+
+
+void BackgroundDeserializationTask::Run() {
+  DisallowHeapAllocation no_allocation;
+  DisallowHandleAllocation no_handles;
+  DisallowHandleDereference no_deref;
+
+  DCHECK(!cache_->checked);
+  ScriptCompiler::CachedData* cached_data = cache_->cached_data.get();
+  // ScriptData takes care of pointer-aligning the data, copying it if needed.
+  cache_->script_data.Reset(
+      new ScriptData(cached_data->data, cached_data->length));
+  // Checking the payload checksum is the expensive part; only the source hash
+  // is left to check on the main thread.
+  cache_->serialized_data.Reset(SerializedCodeData::FromCachedDataOffThread(
+      cache_->script_data.get(), cache_->expected_magic_number,
+      cache_->expected_flag_hash, &cache_->rejection_reason));
+  cache_->checked = true;
+}
+}  // namespace internal
+}  // namespace v8
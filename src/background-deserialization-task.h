@@ -0,0 +1,61 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_BACKGROUND_DESERIALIZATION_TASK_H_
+#define V8_BACKGROUND_DESERIALIZATION_TASK_H_
+
+#include "src/base/smart-pointers.h"
+#include "src/compiler.h"
+#include "src/parsing/preparse-data.h"
+#include "src/snapshot/serialize.h"
+
+namespace v8 {
+namespace internal {
+
+// Internal representation of v8::ScriptCompiler::PreparedCodeCache. Contains
+// the data passed between the main thread, which starts consuming the code
+// cache and finally deserializes it, and the background thread checking it.
+struct PreparedCodeCache {
+  explicit PreparedCodeCache(ScriptCompiler::CachedData* cached_data)
+      : cached_data(cached_data),
+        expected_magic_number(0),
+        expected_flag_hash(0),
+        rejection_reason(0),
+        checked(false) {}
+
+  // Internal implementation of v8::ScriptCompiler::PreparedCodeCache.
+  base::SmartPointer<ScriptCompiler::CachedData> cached_data;
+
+  // Computed on the main thread when the task is created.
+  uint32_t expected_magic_number;
+  uint32_t expected_flag_hash;
+
+  // Set by the background thread. |serialized_data| points into
+  // |script_data| and is empty if the data has been rejected.
+  base::SmartPointer<ScriptData> script_data;
+  base::SmartPointer<SerializedCodeData> serialized_data;
+  int rejection_reason;
+  bool checked;
+
+ private:
+  // Prevent copying. Not implemented.
+  PreparedCodeCache(const PreparedCodeCache&);
+  PreparedCodeCache& operator=(const PreparedCodeCache&);
+};
+
+
+class BackgroundDeserializationTask
+    : public ScriptCompiler::ConsumeCodeCacheTask {
+ public:
+  BackgroundDeserializationTask(PreparedCodeCache* cache, Isolate* isolate);
+
+  virtual void Run();
+
+ private:
+  PreparedCodeCache* cache_;  // Not owned.
+};
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_BACKGROUND_DESERIALIZATION_TASK_H_
@@ -0,0 +1,84 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_CODE_UNIT_WORD_H_
+#define V8_CODE_UNIT_WORD_H_
+
+#include "src/globals.h"
+#include "src/utils.h"
+#include "src/vector.h"
+
+namespace v8 {
+namespace internal {
+
+// The helpers below classify runs of one-byte or two-byte code units a word
+// at a time. A word holds kPerWord code units; the word tests only tell
+// whether any code unit of the word matches, in which case the code units of
+// that word are examined one by one. This works regardless of endianness.
+template <typename Char>
+struct CodeUnitWord {
+  static const int kPerWord = sizeof(uintptr_t) / sizeof(Char);
+  static const uintptr_t kLowBits = kUintptrAllBitsSet / static_cast<Char>(-1);
+  static const uintptr_t kHighBits = kLowBits
+                                     << (kBitsPerByte * sizeof(Char) - 1);
+
+  // Whether any code unit is less than |n|, which must not exceed the value
+  // of the highest bit of a code unit.
+  static bool AnyLessThan(uintptr_t word, Char n) {
+    return ((word - kLowBits * n) & ~word & kHighBits) != 0;
+  }
+
+  static bool AnyEquals(uintptr_t word, Char c) {
+    return AnyLessThan(word ^ (kLowBits * c), 1);
+  }
+
+  // Returns a word in which the highest bit of every code unit equal to |c|
+  // is set. Bits of code units more significant than a match may be set as
+  // well, so the result only narrows down the candidates.
+  static uintptr_t EqualsMask(uintptr_t word, Char c) {
+    uintptr_t difference = word ^ (kLowBits * c);
+    return (difference - kLowBits) & ~difference & kHighBits;
+  }
+
+  static bool AnyNonAscii(uintptr_t word) {
+    return (word & (kLowBits * static_cast<Char>(~0x7F))) != 0;
+  }
+
+  static bool AnyLineTerminator(uintptr_t word) {
+    if (AnyEquals(word, '\n') || AnyEquals(word, '\r')) return true;
+    // 0x2028 and 0x2029 only differ in the lowest bit.
+    return sizeof(Char) == 2 &&
+           AnyEquals(word & (kLowBits * static_cast<Char>(~1)),
+                     static_cast<Char>(0x2028));
+  }
+};
+
+
+// Returns the length of the longest prefix of |chars| that |Run| accepts.
+// Run::Rejects<Char>(word) must return false if it accepts all code units in
+// |word|, Run::Accepts(c) decides for a single code unit.
+template <typename Run, typename Char>
+int WordwisePrefixLength(const Run& run, Vector<const Char> chars) {
+  const Char* cursor = chars.start();
+  const Char* limit = cursor + chars.length();
+  while (cursor < limit &&
+         !IsAligned(reinterpret_cast<intptr_t>(cursor), sizeof(uintptr_t))) {
+    if (!run.Accepts(*cursor)) break;
+    ++cursor;
+  }
+  if (IsAligned(reinterpret_cast<intptr_t>(cursor), sizeof(uintptr_t))) {
+    while (cursor + CodeUnitWord<Char>::kPerWord <= limit &&
+           !run.template Rejects<Char>(
+               *reinterpret_cast<const uintptr_t*>(cursor))) {
+      cursor += CodeUnitWord<Char>::kPerWord;
+    }
+  }
+  while (cursor < limit && run.Accepts(*cursor)) ++cursor;
+  return static_cast<int>(cursor - chars.start());
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_CODE_UNIT_WORD_H_
@@ -5,9 +5,13 @@
 #include "src/compilation-cache.h"
 
 #include "src/assembler.h"
+#include "src/base/smart-pointers.h"
 #include "src/counters.h"
 #include "src/factory.h"
 #include "src/objects-inl.h"
+#include "src/parsing/preparse-data.h"
+#include "src/snapshot/serialize.h"
+#include "src/version.h"
 
 namespace v8 {
 namespace internal {
@@ -298,6 +302,125 @@ MaybeHandle<SharedFunctionInfo> CompilationCache::LookupScript(
 }
 
 
+namespace {
+
+// Computes the key of a script in the code cache backing store. Unlike the
+// string hashes used by the in-heap tables it doesn't depend on the hash
+// seed, so keys are stable across processes. It is a 64-bit FNV-1a hash.
+class BackingStoreKey {
+ public:
+  BackingStoreKey() : hash_(V8_UINT64_C(14695981039346656037)) {}
+
+  void Add(uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+      AddByte(static_cast<uint8_t>(value >> (i * kBitsPerByte)));
+    }
+  }
+
+  void Add(String* string) {
+    DisallowHeapAllocation no_gc;
+    Add(static_cast<uint32_t>(string->length()));
+    String::FlatContent content = string->GetFlatContent();
+    DCHECK(content.IsFlat());
+    if (content.IsOneByte()) {
+      Vector<const uint8_t> chars = content.ToOneByteVector();
+      for (int i = 0; i < chars.length(); i++) AddByte(chars[i]);
+    } else {
+      Vector<const uc16> chars = content.ToUC16Vector();
+      for (int i = 0; i < chars.length(); i++) {
+        AddByte(static_cast<uint8_t>(chars[i]));
+        AddByte(static_cast<uint8_t>(chars[i] >> kBitsPerByte));
+      }
+    }
+  }
+
+  uint64_t hash() const { return hash_; }
+
+ private:
+  void AddByte(uint8_t byte) {
+    hash_ = (hash_ ^ byte) * V8_UINT64_C(1099511628211);
+  }
+
+  uint64_t hash_;
+};
+
+
+uint64_t ComputeBackingStoreKey(Handle<String> source, Handle<Object> name,
+                                int line_offset, int column_offset,
+                                ScriptOriginOptions resource_options,
+                                LanguageMode language_mode) {
+  BackingStoreKey key;
+  key.Add(Version::Hash());
+  key.Add(FlagList::Hash());
+  key.Add(static_cast<uint32_t>(language_mode));
+  key.Add(*String::Flatten(source));
+  if (!name.is_null() && name->IsString()) {
+    key.Add(static_cast<uint32_t>(line_offset));
+    key.Add(static_cast<uint32_t>(column_offset));
+    key.Add(static_cast<uint32_t>(resource_options.Flags()));
+    key.Add(*String::Flatten(Handle<String>::cast(name)));
+  }
+  return key.hash();
+}
+
+
+// Distinguishes regexp keys from script keys, which have the language mode
+// in this position.
+static const uint32_t kRegExpKeyTag = 0xffffffff;
+
+
+uint64_t ComputeRegExpBackingStoreKey(Handle<String> source,
+                                      JSRegExp::Flags flags) {
+  BackingStoreKey key;
+  key.Add(Version::Hash());
+  key.Add(FlagList::Hash());
+  key.Add(kRegExpKeyTag);
+  key.Add(static_cast<uint32_t>(flags));
+  key.Add(*String::Flatten(source));
+  return key.hash();
+}
+
+}  // namespace
+
+
+bool CompilationCache::HasBackingStore() {
+  return IsEnabled() && isolate()->code_cache_backing_store() != NULL;
+}
+
+
+MaybeHandle<SharedFunctionInfo> CompilationCache::LookupScriptInBackingStore(
+    Handle<String> source, Handle<Object> name, int line_offset,
+    int column_offset, ScriptOriginOptions resource_options,
+    Handle<Context> context, LanguageMode language_mode) {
+  DCHECK(HasBackingStore());
+  v8::ScriptCompiler::CodeCacheBackingStore* store =
+      isolate()->code_cache_backing_store();
+  uint64_t key = ComputeBackingStoreKey(source, name, line_offset,
+                                        column_offset, resource_options,
+                                        language_mode);
+  const v8::ScriptCompiler::CachedData* data = store->Lookup(key);
+  if (data == NULL) {
+    isolate()->counters()->code_cache_store_misses()->Increment();
+    return MaybeHandle<SharedFunctionInfo>();
+  }
+  Handle<SharedFunctionInfo> result;
+  bool success;
+  {
+    ScriptData script_data(data->data, data->length);
+    success = CodeSerializer::Deserialize(isolate(), &script_data, source)
+                  .ToHandle(&result);
+  }
+  store->Release(data, !success);
+  if (!success) {
+    isolate()->counters()->code_cache_store_rejects()->Increment();
+    return MaybeHandle<SharedFunctionInfo>();
+  }
+  isolate()->counters()->code_cache_store_hits()->Increment();
+  PutScript(source, context, language_mode, result);
+  return result;
+}
+
+
 MaybeHandle<SharedFunctionInfo> CompilationCache::LookupEval(
     Handle<String> source, Handle<SharedFunctionInfo> outer_info,
     Handle<Context> context, LanguageMode language_mode, int scope_position) {
@@ -334,6 +457,27 @@ void CompilationCache::PutScript(Handle<String> source,
 }
 
 
+void CompilationCache::PutScriptInBackingStore(
+    Handle<String> source, Handle<Object> name, int line_offset,
+    int column_offset, ScriptOriginOptions resource_options,
+    LanguageMode language_mode, Handle<SharedFunctionInfo> function_info,
+    ScriptData* data) {
+  DCHECK(HasBackingStore());
+  base::SmartPointer<ScriptData> serialized;
+  if (data == NULL) {
+    serialized.Reset(CodeSerializer::Serialize(isolate(), function_info,
+                                               source));
+    data = serialized.get();
+  }
+  uint64_t key = ComputeBackingStoreKey(source, name, line_offset,
+                                        column_offset, resource_options,
+                                        language_mode);
+  isolate()->code_cache_backing_store()->Store(key, data->data(),
+                                               data->length());
+  isolate()->counters()->code_cache_store_writes()->Increment();
+}
+
+
 void CompilationCache::PutEval(Handle<String> source,
                                Handle<SharedFunctionInfo> outer_info,
                                Handle<Context> context,
@@ -352,6 +496,48 @@ void CompilationCache::PutEval(Handle<String> source,
 
 
 
+MaybeHandle<FixedArray> CompilationCache::LookupRegExpInBackingStore(
+    Handle<String> source, JSRegExp::Flags flags) {
+  DCHECK(HasBackingStore());
+  v8::ScriptCompiler::CodeCacheBackingStore* store =
+      isolate()->code_cache_backing_store();
+  uint64_t key = ComputeRegExpBackingStoreKey(source, flags);
+  const v8::ScriptCompiler::CachedData* data = store->Lookup(key);
+  if (data == NULL) {
+    isolate()->counters()->code_cache_store_misses()->Increment();
+    return MaybeHandle<FixedArray>();
+  }
+  Handle<FixedArray> result;
+  bool success;
+  {
+    ScriptData script_data(data->data, data->length);
+    success = CodeSerializer::DeserializeRegExpData(isolate(), &script_data,
+                                                    source).ToHandle(&result);
+  }
+  store->Release(data, !success);
+  if (!success) {
+    isolate()->counters()->code_cache_store_rejects()->Increment();
+    return MaybeHandle<FixedArray>();
+  }
+  isolate()->counters()->code_cache_store_hits()->Increment();
+  PutRegExp(source, flags, result);
+  return result;
+}
+
+
+void CompilationCache::PutRegExpInBackingStore(Handle<String> source,
+                                               JSRegExp::Flags flags,
+                                               Handle<FixedArray> data) {
+  DCHECK(HasBackingStore());
+  base::SmartPointer<ScriptData> serialized(
+      CodeSerializer::SerializeRegExpData(isolate(), data, source));
+  uint64_t key = ComputeRegExpBackingStoreKey(source, flags);
+  isolate()->code_cache_backing_store()->Store(key, serialized->data(),
+                                               serialized->length());
+  isolate()->counters()->code_cache_store_writes()->Increment();
+}
+
+
 void CompilationCache::PutRegExp(Handle<String> source,
                                  JSRegExp::Flags flags,
                                  Handle<FixedArray> data) {
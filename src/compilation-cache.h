@@ -12,6 +12,8 @@
 namespace v8 {
 namespace internal {
 
+class ScriptData;
+
 // The compilation cache consists of several generational sub-caches which uses
 // this class as a base class. A sub-cache contains a compilation cache tables
 // for each generation of the sub-cache. Since the same source code string has
@@ -155,6 +157,14 @@ class CompilationCache {
       int column_offset, ScriptOriginOptions resource_options,
       Handle<Context> context, LanguageMode language_mode);
 
+  // Finds the script shared function info for a source string in the
+  // embedder's code cache backing store and promotes it to this cache.
+  // Must only be called if HasBackingStore().
+  MaybeHandle<SharedFunctionInfo> LookupScriptInBackingStore(
+      Handle<String> source, Handle<Object> name, int line_offset,
+      int column_offset, ScriptOriginOptions resource_options,
+      Handle<Context> context, LanguageMode language_mode);
+
   // Finds the shared function info for a source string for eval in a
   // given context.  Returns an empty handle if the cache doesn't
   // contain a script for the given source string.
@@ -174,6 +184,19 @@ class CompilationCache {
                  LanguageMode language_mode,
                  Handle<SharedFunctionInfo> function_info);
 
+  // Adds the code of a script that was compiled for serialization to the
+  // embedder's code cache backing store. If |data| is NULL the script is
+  // serialized first. Must only be called if HasBackingStore().
+  void PutScriptInBackingStore(Handle<String> source, Handle<Object> name,
+                               int line_offset, int column_offset,
+                               ScriptOriginOptions resource_options,
+                               LanguageMode language_mode,
+                               Handle<SharedFunctionInfo> function_info,
+                               ScriptData* data);
+
+  // Whether the embedder provided a code cache backing store.
+  bool HasBackingStore();
+
   // Associate the (source, context->closure()->shared(), kind) triple
   // with the shared function info. This may overwrite an existing mapping.
   void PutEval(Handle<String> source, Handle<SharedFunctionInfo> outer_info,
@@ -186,6 +209,18 @@ class CompilationCache {
                  JSRegExp::Flags flags,
                  Handle<FixedArray> data);
 
+  // Finds the data of an irregexp regexp with its compiled code in the
+  // embedder's code cache backing store and promotes it to this cache.
+  // Must only be called if HasBackingStore().
+  MaybeHandle<FixedArray> LookupRegExpInBackingStore(Handle<String> source,
+                                                     JSRegExp::Flags flags);
+
+  // Adds the data of an irregexp regexp with the code compiled so far to the
+  // embedder's code cache backing store, replacing earlier data for the same
+  // (source, flags) pair. Must only be called if HasBackingStore().
+  void PutRegExpInBackingStore(Handle<String> source, JSRegExp::Flags flags,
+                               Handle<FixedArray> data);
+
   // Clear the cache - also used to initialize the cache at startup.
   void Clear();
 
@@ -1424,7 +1424,7 @@ Handle<SharedFunctionInfo> Compiler::CompileScript(
     Handle<Object> source_map_url, Handle<Context> context,
     v8::Extension* extension, ScriptData** cached_data,
     ScriptCompiler::CompileOptions compile_options, NativesFlag natives,
-    bool is_module) {
+    bool is_module, SerializedCodeData* prepared_code_cache) {
   Isolate* isolate = source->GetIsolate();
   if (compile_options == ScriptCompiler::kNoCompileOptions) {
     cached_data = NULL;
@@ -1439,6 +1439,8 @@ Handle<SharedFunctionInfo> Compiler::CompileScript(
     DCHECK(cached_data && *cached_data);
     DCHECK(extension == NULL);
   }
+  DCHECK(prepared_code_cache == NULL ||
+         compile_options == ScriptCompiler::kConsumeCodeCache);
   int source_length = source->length();
   isolate->counters()->total_load_size()->Increment(source_length);
   isolate->counters()->total_compile_size()->Increment(source_length);
@@ -1451,6 +1453,13 @@ Handle<SharedFunctionInfo> Compiler::CompileScript(
 
   CompilationCache* compilation_cache = isolate->compilation_cache();
 
+  // Scripts other than natives and extensions are also looked up in and added
+  // to the embedder's code cache backing store, if there is one.
+  bool use_backing_store = extension == NULL && natives == NOT_NATIVES_CODE &&
+                           FLAG_serialize_toplevel &&
+                           !isolate->debug()->is_loaded() &&
+                           compilation_cache->HasBackingStore();
+
   // Do a lookup in the compilation cache but not for extensions.
   MaybeHandle<SharedFunctionInfo> maybe_result;
   Handle<SharedFunctionInfo> result;
@@ -1466,14 +1475,29 @@ Handle<SharedFunctionInfo> Compiler::CompileScript(
       HistogramTimerScope timer(isolate->counters()->compile_deserialize());
       TRACE_EVENT0("v8", "V8.CompileDeserialize");
       Handle<SharedFunctionInfo> result;
-      if (CodeSerializer::Deserialize(isolate, *cached_data, source)
-              .ToHandle(&result)) {
+      MaybeHandle<SharedFunctionInfo> deserialized =
+          prepared_code_cache == NULL
+              ? CodeSerializer::Deserialize(isolate, *cached_data, source)
+              : CodeSerializer::DeserializePrepared(
+                    isolate, *cached_data, prepared_code_cache, source);
+      if (deserialized.ToHandle(&result)) {
         // Promote to per-isolate compilation cache.
         compilation_cache->PutScript(source, context, language_mode, result);
         return result;
       }
       // Deserializer failed. Fall through to compile.
     }
+    if (maybe_result.is_null() && use_backing_store) {
+      HistogramTimerScope timer(isolate->counters()->compile_deserialize());
+      TRACE_EVENT0("v8", "V8.CompileDeserialize");
+      Handle<SharedFunctionInfo> result;
+      if (compilation_cache->LookupScriptInBackingStore(
+                                source, script_name, line_offset, column_offset,
+                                resource_options, context, language_mode)
+              .ToHandle(&result)) {
+        return result;
+      }
+    }
   }
 
   base::ElapsedTimer timer;
@@ -1520,7 +1544,8 @@ Handle<SharedFunctionInfo> Compiler::CompileScript(
     parse_info.set_extension(extension);
     parse_info.set_context(context);
     if (FLAG_serialize_toplevel &&
-        compile_options == ScriptCompiler::kProduceCodeCache) {
+        (compile_options == ScriptCompiler::kProduceCodeCache ||
+         use_backing_store)) {
       info.PrepareForSerializing();
     }
 
@@ -1540,6 +1565,17 @@ Handle<SharedFunctionInfo> Compiler::CompileScript(
                  timer.Elapsed().InMillisecondsF());
         }
       }
+      if (use_backing_store) {
+        HistogramTimerScope histogram_timer(
+            isolate->counters()->compile_serialize());
+        TRACE_EVENT0("v8", "V8.CompileSerialize");
+        ScriptData* data =
+            compile_options == ScriptCompiler::kProduceCodeCache ? *cached_data
+                                                                 : NULL;
+        compilation_cache->PutScriptInBackingStore(
+            source, script_name, line_offset, column_offset, resource_options,
+            language_mode, result, data);
+      }
     }
 
     if (result.is_null()) {
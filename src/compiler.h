@@ -20,6 +20,7 @@ namespace internal {
 class JavaScriptFrame;
 class ParseInfo;
 class ScriptData;
+class SerializedCodeData;
 
 
 struct InlinedFunctionInfo {
@@ -621,7 +622,8 @@ class Compiler : public AllStatic {
       Handle<Object> source_map_url, Handle<Context> context,
       v8::Extension* extension, ScriptData** cached_data,
       ScriptCompiler::CompileOptions compile_options,
-      NativesFlag is_natives_code, bool is_module);
+      NativesFlag is_natives_code, bool is_module,
+      SerializedCodeData* prepared_code_cache = NULL);
 
   static Handle<SharedFunctionInfo> CompileStreamedScript(Handle<Script> script,
                                                           ParseInfo* info,
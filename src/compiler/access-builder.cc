@@ -146,6 +146,16 @@ FieldAccess AccessBuilder::ForJSIteratorResultValue() {
 }
 
 
+// static
+FieldAccess AccessBuilder::ForJSCollectionTable() {
+  STATIC_ASSERT(JSCollection::kTableOffset == JSWeakCollection::kTableOffset);
+  FieldAccess access = {kTaggedBase, JSCollection::kTableOffset,
+                        MaybeHandle<Name>(), Type::Internal(),
+                        MachineType::AnyTagged()};
+  return access;
+}
+
+
 // static
 FieldAccess AccessBuilder::ForJSRegExpFlags() {
   FieldAccess access = {kTaggedBase, JSRegExp::kFlagsOffset,
@@ -199,6 +209,14 @@ FieldAccess AccessBuilder::ForMapBitField() {
 }
 
 
+// static
+FieldAccess AccessBuilder::ForMapBitField2() {
+  FieldAccess access = {kTaggedBase, Map::kBitField2Offset, Handle<Name>(),
+                        TypeCache::Get().kUint8, MachineType::Uint8()};
+  return access;
+}
+
+
 // static
 FieldAccess AccessBuilder::ForMapBitField3() {
   FieldAccess access = {kTaggedBase, Map::kBitField3Offset, Handle<Name>(),
@@ -231,6 +249,14 @@ FieldAccess AccessBuilder::ForMapPrototype() {
 }
 
 
+// static
+FieldAccess AccessBuilder::ForNameHashField() {
+  FieldAccess access = {kTaggedBase, Name::kHashFieldOffset, Handle<Name>(),
+                        Type::Unsigned32(), MachineType::Uint32()};
+  return access;
+}
+
+
 // static
 FieldAccess AccessBuilder::ForStringLength() {
   FieldAccess access = {kTaggedBase, String::kLengthOffset, Handle<Name>(),
@@ -45,6 +45,8 @@ Reduction JSIntrinsicLowering::Reduce(Node* node) {
       return ReduceDoubleHi(node);
     case Runtime::kInlineDoubleLo:
       return ReduceDoubleLo(node);
+    case Runtime::kInlineHasFastPackedElements:
+      return ReduceHasFastPackedElements(node);
     case Runtime::kInlineIncrementStatsCounter:
       return ReduceIncrementStatsCounter(node);
     case Runtime::kInlineIsArray:
@@ -57,6 +59,8 @@ Reduction JSIntrinsicLowering::Reduce(Node* node) {
       return ReduceIsJSReceiver(node);
     case Runtime::kInlineIsSmi:
       return ReduceIsSmi(node);
+    case Runtime::kInlineJSCollectionGetTable:
+      return ReduceJSCollectionGetTable(node);
     case Runtime::kInlineMathClz32:
       return ReduceMathClz32(node);
     case Runtime::kInlineMathFloor:
@@ -77,8 +81,12 @@ Reduction JSIntrinsicLowering::Reduce(Node* node) {
       return ReduceRegExpFlags(node);
     case Runtime::kInlineRegExpSource:
       return ReduceRegExpSource(node);
+    case Runtime::kInlineStringGetRawHashField:
+      return ReduceStringGetRawHashField(node);
     case Runtime::kInlineSubString:
       return ReduceSubString(node);
+    case Runtime::kInlineTheHole:
+      return ReduceTheHole(node);
     case Runtime::kInlineToInteger:
       return ReduceToInteger(node);
     case Runtime::kInlineToLength:
@@ -183,6 +191,60 @@ Reduction JSIntrinsicLowering::ReduceIncrementStatsCounter(Node* node) {
 }
 
 
+Reduction JSIntrinsicLowering::ReduceHasFastPackedElements(Node* node) {
+  // if (%_IsSmi(value)) {
+  //   return false;
+  // } else {
+  //   return IsFastPackedElementsKind(%_GetElementsKind(%_GetMap(value)));
+  // }
+  Node* value = NodeProperties::GetValueInput(node, 0);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+
+  Node* check = graph()->NewNode(simplified()->ObjectIsSmi(), value);
+  Node* branch = graph()->NewNode(common()->Branch(), check, control);
+
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* etrue = effect;
+  Node* vtrue = jsgraph()->FalseConstant();
+
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* efalse = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForMapBitField2()),
+      graph()->NewNode(simplified()->LoadField(AccessBuilder::ForMap()), value,
+                       effect, if_false),
+      effect, if_false);
+  Node* kind = graph()->NewNode(
+      machine()->Word32Shr(),
+      graph()->NewNode(machine()->Word32And(), efalse,
+                       jsgraph()->Int32Constant(Map::ElementsKindBits::kMask)),
+      jsgraph()->Int32Constant(Map::ElementsKindBits::kShift));
+  // Test that the bit for {kind} is not outside of the set of packed fast
+  // elements kinds.
+  STATIC_ASSERT(kElementsKindCount <= 32);
+  const int kPackedKinds = (1 << FAST_SMI_ELEMENTS) | (1 << FAST_ELEMENTS) |
+                           (1 << FAST_DOUBLE_ELEMENTS);
+  Node* vfalse = graph()->NewNode(
+      machine()->Word32Equal(),
+      graph()->NewNode(
+          machine()->Word32And(),
+          graph()->NewNode(machine()->Word32Shl(), jsgraph()->Int32Constant(1),
+                           kind),
+          jsgraph()->Int32Constant(~kPackedKinds)),
+      jsgraph()->Int32Constant(0));
+
+  Node* merge = graph()->NewNode(common()->Merge(2), if_true, if_false);
+
+  // Replace all effect uses of {node} with the {ephi}.
+  Node* ephi = graph()->NewNode(common()->EffectPhi(2), etrue, efalse, merge);
+  ReplaceWithValue(node, node, ephi);
+
+  // Turn the {node} into a Phi.
+  return Change(node, common()->Phi(MachineRepresentation::kTagged, 2), vtrue,
+                vfalse, merge);
+}
+
+
 Reduction JSIntrinsicLowering::ReduceIsInstanceType(
     Node* node, InstanceType instance_type) {
   // if (%_IsSmi(value)) {
@@ -232,6 +294,16 @@ Reduction JSIntrinsicLowering::ReduceIsSmi(Node* node) {
 }
 
 
+Reduction JSIntrinsicLowering::ReduceJSCollectionGetTable(Node* node) {
+  Node* const collection = NodeProperties::GetValueInput(node, 0);
+  Node* const effect = NodeProperties::GetEffectInput(node);
+  Node* const control = NodeProperties::GetControlInput(node);
+  Operator const* const op =
+      simplified()->LoadField(AccessBuilder::ForJSCollectionTable());
+  return Change(node, op, collection, effect, control);
+}
+
+
 Reduction JSIntrinsicLowering::ReduceMathClz32(Node* node) {
   return Change(node, machine()->Word32Clz());
 }
@@ -379,11 +451,28 @@ Reduction JSIntrinsicLowering::ReduceRegExpSource(Node* node) {
 }
 
 
+Reduction JSIntrinsicLowering::ReduceStringGetRawHashField(Node* node) {
+  Node* const string = NodeProperties::GetValueInput(node, 0);
+  Node* const effect = NodeProperties::GetEffectInput(node);
+  Node* const control = NodeProperties::GetControlInput(node);
+  Operator const* const op =
+      simplified()->LoadField(AccessBuilder::ForNameHashField());
+  return Change(node, op, string, effect, control);
+}
+
+
 Reduction JSIntrinsicLowering::ReduceSubString(Node* node) {
   return Change(node, CodeFactory::SubString(isolate()), 3);
 }
 
 
+Reduction JSIntrinsicLowering::ReduceTheHole(Node* node) {
+  Node* value = jsgraph()->TheHoleConstant();
+  ReplaceWithValue(node, value);
+  return Replace(value);
+}
+
+
 Reduction JSIntrinsicLowering::ReduceToInteger(Node* node) {
   Node* value = NodeProperties::GetValueInput(node, 0);
   Node* context = NodeProperties::GetContextInput(node);
@@ -43,10 +43,12 @@ class JSIntrinsicLowering final : public AdvancedReducer {
   Reduction ReduceDeoptimizeNow(Node* node);
   Reduction ReduceDoubleHi(Node* node);
   Reduction ReduceDoubleLo(Node* node);
+  Reduction ReduceHasFastPackedElements(Node* node);
   Reduction ReduceIncrementStatsCounter(Node* node);
   Reduction ReduceIsInstanceType(Node* node, InstanceType instance_type);
   Reduction ReduceIsJSReceiver(Node* node);
   Reduction ReduceIsSmi(Node* node);
+  Reduction ReduceJSCollectionGetTable(Node* node);
   Reduction ReduceMathClz32(Node* node);
   Reduction ReduceMathFloor(Node* node);
   Reduction ReduceMathSqrt(Node* node);
@@ -57,7 +59,9 @@ class JSIntrinsicLowering final : public AdvancedReducer {
   Reduction ReduceRegExpExec(Node* node);
   Reduction ReduceRegExpFlags(Node* node);
   Reduction ReduceRegExpSource(Node* node);
+  Reduction ReduceStringGetRawHashField(Node* node);
   Reduction ReduceSubString(Node* node);
+  Reduction ReduceTheHole(Node* node);
   Reduction ReduceToInteger(Node* node);
   Reduction ReduceToLength(Node* node);
   Reduction ReduceToName(Node* node);
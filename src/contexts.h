@@ -137,6 +137,7 @@ enum BindingFlags {
   V(PROMISE_FUNCTION_INDEX, JSFunction, promise_function)                     \
   V(PROMISE_HAS_USER_DEFINED_REJECT_HANDLER_INDEX, JSFunction,                \
     promise_has_user_defined_reject_handler)                                  \
+  V(PROMISE_REACTION_JOB_INDEX, JSFunction, promise_reaction_job)             \
   V(PROMISE_REJECT_INDEX, JSFunction, promise_reject)                         \
   V(PROMISE_RESOLVE_INDEX, JSFunction, promise_resolve)                       \
   V(PROMISE_THEN_INDEX, JSFunction, promise_then)                             \
@@ -582,6 +582,11 @@ double AggregatedMemoryHistogram<Histogram>::Aggregate(double current_ms,
   SC(arguments_adaptors, V8.ArgumentsAdaptors)                        \
   SC(compilation_cache_hits, V8.CompilationCacheHits)                 \
   SC(compilation_cache_misses, V8.CompilationCacheMisses)             \
+  /* Lookups in the embedder's code cache backing store. */            \
+  SC(code_cache_store_hits, V8.CodeCacheStoreHits)                    \
+  SC(code_cache_store_misses, V8.CodeCacheStoreMisses)                \
+  SC(code_cache_store_rejects, V8.CodeCacheStoreRejects)              \
+  SC(code_cache_store_writes, V8.CodeCacheStoreWrites)                \
   /* Amount of evaled source code. */                                 \
   SC(total_eval_size, V8.TotalEvalSize)                               \
   /* Amount of loaded source code. */                                 \
@@ -624,6 +629,8 @@ double AggregatedMemoryHistogram<Histogram>::Aggregate(double current_ms,
   SC(ic_named_load_global_stub, V8.ICNamedLoadGlobalStub)                      \
   SC(ic_store_normal_miss, V8.ICStoreNormalMiss)                               \
   SC(ic_store_normal_hit, V8.ICStoreNormalHit)                                 \
+  SC(ic_handlers_compiled, V8.ICHandlersCompiled)                              \
+  SC(ic_shared_handlers, V8.ICSharedHandlers)                                  \
   SC(ic_binary_op_miss, V8.ICBinaryOpMiss)                                     \
   SC(ic_compare_miss, V8.ICCompareMiss)                                        \
   SC(ic_call_miss, V8.ICCallMiss)                                              \
@@ -634,6 +641,7 @@ double AggregatedMemoryHistogram<Histogram>::Aggregate(double current_ms,
   SC(ic_keyed_store_miss, V8.ICKeyedStoreMiss)                                 \
   SC(cow_arrays_created_runtime, V8.COWArraysCreatedRuntime)                   \
   SC(cow_arrays_converted, V8.COWArraysConverted)                              \
+  SC(inobject_properties_predicted, V8.InobjectPropertiesPredicted)            \
   SC(constructed_objects, V8.ConstructedObjects)                               \
   SC(constructed_objects_runtime, V8.ConstructedObjectsRuntime)                \
   SC(negative_lookups, V8.NegativeLookups)                                     \
@@ -641,6 +649,7 @@ double AggregatedMemoryHistogram<Histogram>::Aggregate(double current_ms,
   SC(megamorphic_stub_cache_probes, V8.MegamorphicStubCacheProbes)             \
   SC(megamorphic_stub_cache_misses, V8.MegamorphicStubCacheMisses)             \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
+  SC(megamorphic_stub_cache_collisions, V8.MegamorphicStubCacheCollisions)     \
   SC(enum_cache_hits, V8.EnumCacheHits)                                        \
   SC(enum_cache_misses, V8.EnumCacheMisses)                                    \
   SC(fast_new_closure_total, V8.FastNewClosureTotal)                           \
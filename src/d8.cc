@@ -19,6 +19,7 @@
 
 #ifndef V8_SHARED
 #include <algorithm>
+#include <string>
 #include <vector>
 #endif  // !V8_SHARED
 
@@ -159,6 +160,156 @@ class PredictablePlatform : public Platform {
 
   DISALLOW_COPY_AND_ASSIGN(PredictablePlatform);
 };
+
+
+// ScriptCompiler::CodeCacheBackingStore that keeps each entry in a file of
+// its own in a directory. Entries are written to a temporary file that is
+// renamed into place, so concurrent readers never see partially written
+// entries, and they are memory-mapped when read. The directory's index file
+// lists the entries from least to most recently used; once there are more
+// than |max_entries| of them, the least recently used ones are deleted.
+class DiskCodeCacheStore : public ScriptCompiler::CodeCacheBackingStore {
+ public:
+  DiskCodeCacheStore(const char* directory, int max_entries)
+      : directory_(directory), max_entries_(max_entries) {
+    ReadIndex();
+  }
+
+  ~DiskCodeCacheStore() override {
+    DCHECK(mapped_.empty());
+    WriteIndex();
+  }
+
+  const ScriptCompiler::CachedData* Lookup(uint64_t key) override {
+    base::LockGuard<base::Mutex> lock_guard(&mutex_);
+    base::OS::MemoryMappedFile* file =
+        base::OS::MemoryMappedFile::open(EntryPath(key).c_str());
+    if (file == NULL) return NULL;
+    if (file->size() == 0) {
+      delete file;
+      return NULL;
+    }
+    MappedEntry entry;
+    entry.key = key;
+    entry.file = file;
+    entry.data = new ScriptCompiler::CachedData(
+        static_cast<const uint8_t*>(file->memory()),
+        static_cast<int>(file->size()));
+    mapped_.push_back(entry);
+    Touch(key);
+    return entry.data;
+  }
+
+  void Release(const ScriptCompiler::CachedData* data, bool rejected) override {
+    base::LockGuard<base::Mutex> lock_guard(&mutex_);
+    for (size_t i = 0; i < mapped_.size(); i++) {
+      if (mapped_[i].data != data) continue;
+      uint64_t key = mapped_[i].key;
+      delete mapped_[i].data;
+      delete mapped_[i].file;
+      mapped_.erase(mapped_.begin() + i);
+      // Stale entries are overwritten when the script has been recompiled.
+      if (rejected) Remove(key);
+      return;
+    }
+    UNREACHABLE();
+  }
+
+  void Store(uint64_t key, const uint8_t* data, int length) override {
+    base::LockGuard<base::Mutex> lock_guard(&mutex_);
+    if (WriteFile(EntryPath(key), data, length)) Touch(key);
+  }
+
+ private:
+  struct MappedEntry {
+    uint64_t key;
+    base::OS::MemoryMappedFile* file;
+    ScriptCompiler::CachedData* data;
+  };
+
+  std::string EntryPath(uint64_t key) const {
+    char name[32];
+    base::OS::SNPrintF(name, sizeof(name), "/%08x%08x.code",
+                       static_cast<uint32_t>(key >> 32),
+                       static_cast<uint32_t>(key));
+    return directory_ + name;
+  }
+
+  std::string IndexPath() const { return directory_ + "/index"; }
+
+  // Writes the file through a temporary file, so that readers see either the
+  // old or the new contents.
+  bool WriteFile(const std::string& path, const uint8_t* data, int length) {
+    char suffix[32];
+    base::OS::SNPrintF(suffix, sizeof(suffix), ".%d.tmp",
+                       base::OS::GetCurrentProcessId());
+    std::string temp_path = path + suffix;
+    FILE* file = base::OS::FOpen(temp_path.c_str(), "wb");
+    if (file == NULL) return false;
+    bool success = fwrite(data, 1, length, file) == static_cast<size_t>(length);
+    success = fclose(file) == 0 && success;
+    if (success && rename(temp_path.c_str(), path.c_str()) != 0) {
+      // Renaming onto an existing file fails on some platforms.
+      base::OS::Remove(path.c_str());
+      success = rename(temp_path.c_str(), path.c_str()) == 0;
+    }
+    if (!success) base::OS::Remove(temp_path.c_str());
+    return success;
+  }
+
+  // Marks the entry as the most recently used one and evicts the least
+  // recently used entries if there are too many.
+  void Touch(uint64_t key) {
+    std::vector<uint64_t>::iterator it =
+        std::find(lru_.begin(), lru_.end(), key);
+    if (it != lru_.end()) lru_.erase(it);
+    lru_.push_back(key);
+    while (static_cast<int>(lru_.size()) > max_entries_) {
+      // Mappings of removed files stay valid on POSIX systems.
+      base::OS::Remove(EntryPath(lru_.front()).c_str());
+      lru_.erase(lru_.begin());
+    }
+  }
+
+  void Remove(uint64_t key) {
+    std::vector<uint64_t>::iterator it =
+        std::find(lru_.begin(), lru_.end(), key);
+    if (it != lru_.end()) lru_.erase(it);
+    base::OS::Remove(EntryPath(key).c_str());
+  }
+
+  void ReadIndex() {
+    FILE* file = base::OS::FOpen(IndexPath().c_str(), "r");
+    if (file == NULL) return;
+    unsigned int high, low;
+    while (fscanf(file, "%8x%8x\n", &high, &low) == 2) {
+      lru_.push_back(static_cast<uint64_t>(high) << 32 | low);
+    }
+    fclose(file);
+  }
+
+  void WriteIndex() {
+    std::string index;
+    for (size_t i = 0; i < lru_.size(); i++) {
+      char line[32];
+      base::OS::SNPrintF(line, sizeof(line), "%08x%08x\n",
+                         static_cast<uint32_t>(lru_[i] >> 32),
+                         static_cast<uint32_t>(lru_[i]));
+      index += line;
+    }
+    WriteFile(IndexPath(), reinterpret_cast<const uint8_t*>(index.data()),
+              static_cast<int>(index.length()));
+  }
+
+  base::Mutex mutex_;
+  std::string directory_;
+  int max_entries_;
+  // Keys of the entries, least recently used first.
+  std::vector<uint64_t> lru_;
+  std::vector<MappedEntry> mapped_;
+
+  DISALLOW_COPY_AND_ASSIGN(DiskCodeCacheStore);
+};
 #endif  // !V8_SHARED
 
 
@@ -260,6 +411,7 @@ i::List<SharedArrayBuffer::Contents> Shell::externalized_shared_contents_;
 
 Global<Context> Shell::evaluation_context_;
 ArrayBuffer::Allocator* Shell::array_buffer_allocator;
+ScriptCompiler::CodeCacheBackingStore* Shell::code_cache_backing_store;
 ShellOptions Shell::options;
 base::OnceType Shell::quit_once_ = V8_ONCE_INIT;
 
@@ -1579,6 +1731,7 @@ base::Thread::Options SourceGroup::GetThreadOptions() {
 void SourceGroup::ExecuteInThread() {
   Isolate::CreateParams create_params;
   create_params.array_buffer_allocator = Shell::array_buffer_allocator;
+  create_params.code_cache_backing_store = Shell::code_cache_backing_store;
   Isolate* isolate = Isolate::New(create_params);
   for (int i = 0; i < Shell::options.stress_runs; ++i) {
     next_semaphore_.Wait();
@@ -1992,6 +2145,14 @@ bool Shell::SetOptions(int argc, char* argv[]) {
         return false;
       }
       argv[i] = NULL;
+#ifndef V8_SHARED
+    } else if (strncmp(argv[i], "--code-cache-dir=", 17) == 0) {
+      options.code_cache_dir = argv[i] + 17;
+      argv[i] = NULL;
+    } else if (strncmp(argv[i], "--code-cache-max-entries=", 25) == 0) {
+      options.code_cache_max_entries = atoi(argv[i] + 25);
+      argv[i] = NULL;
+#endif  // !V8_SHARED
     }
   }
 
@@ -2463,6 +2624,15 @@ int Shell::Main(int argc, char* argv[]) {
     Shell::array_buffer_allocator = &shell_array_buffer_allocator;
   }
   create_params.array_buffer_allocator = Shell::array_buffer_allocator;
+#ifndef V8_SHARED
+  base::SmartPointer<DiskCodeCacheStore> code_cache_store;
+  if (options.code_cache_dir != NULL) {
+    code_cache_store.Reset(new DiskCodeCacheStore(
+        options.code_cache_dir, options.code_cache_max_entries));
+    Shell::code_cache_backing_store = code_cache_store.get();
+    create_params.code_cache_backing_store = code_cache_store.get();
+  }
+#endif  // !V8_SHARED
 #ifdef ENABLE_VTUNE_JIT_INTERFACE
   create_params.code_event_handler = vTune::GetVtuneCodeEventHandler();
 #endif
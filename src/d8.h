@@ -290,7 +290,9 @@ class ShellOptions {
         isolate_sources(NULL),
         icu_data_file(NULL),
         natives_blob(NULL),
-        snapshot_blob(NULL) {}
+        snapshot_blob(NULL),
+        code_cache_dir(NULL),
+        code_cache_max_entries(1000) {}
 
   ~ShellOptions() {
     delete[] isolate_sources;
@@ -318,6 +320,8 @@ class ShellOptions {
   const char* icu_data_file;
   const char* natives_blob;
   const char* snapshot_blob;
+  const char* code_cache_dir;
+  int code_cache_max_entries;
 };
 
 #ifdef V8_SHARED
@@ -441,6 +445,7 @@ class Shell : public i::AllStatic {
   static const char* kPrompt;
   static ShellOptions options;
   static ArrayBuffer::Allocator* array_buffer_allocator;
+  static ScriptCompiler::CodeCacheBackingStore* code_cache_backing_store;
 
  private:
   static Global<Context> evaluation_context_;
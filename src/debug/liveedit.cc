@@ -1405,6 +1405,8 @@ Handle<Object> LiveEdit::ChangeScriptSource(Handle<Script> original_script,
 
   // Drop line ends so that they will be recalculated.
   original_script->set_line_ends(isolate->heap()->undefined_value());
+  // Recorded inner function data refers to positions in the old source.
+  original_script->set_preparse_data(isolate->heap()->undefined_value());
 
   return old_script_object;
 }
@@ -53,6 +53,10 @@ namespace {
 
 static const int kPackedSizeNotKnown = -1;
 
+// Slices of whole arrays shorter than this are copied rather than sharing a
+// copy-on-write backing store with the receiver.
+static const uint32_t kMinCopyOnWriteSliceLength = 16;
+
 enum Where { AT_START, AT_END };
 
 
@@ -149,6 +153,15 @@ void CopyObjectToObjectElements(FixedArrayBase* from_base,
        from_kind == FAST_STRING_WRAPPER_ELEMENTS)
           ? UPDATE_WRITE_BARRIER
           : SKIP_WRITE_BARRIER;
+  if (write_barrier_mode == UPDATE_WRITE_BARRIER) {
+    write_barrier_mode = to->GetWriteBarrierMode(no_allocation);
+  }
+  if (write_barrier_mode == SKIP_WRITE_BARRIER && from != to) {
+    // Without write barriers the elements can be copied in bulk.
+    CopyWords(to->data_start() + to_start, from->data_start() + from_start,
+              static_cast<size_t>(copy_size));
+    return;
+  }
   for (int i = 0; i < copy_size; i++) {
     Object* value = from->get(from_start + i);
     to->set(to_start + i, value, write_barrier_mode);
@@ -1605,6 +1618,30 @@ class FastSmiOrObjectElementsAccessor
     return backing_store->get(index);
   }
 
+  static Handle<JSArray> SliceImpl(Handle<JSObject> receiver,
+                                   Handle<FixedArrayBase> backing_store,
+                                   uint32_t start, uint32_t end) {
+    DCHECK(start < end);
+    if (IsFastPackedElementsKind(KindTraits::Kind) && start == 0 &&
+        end >= kMinCopyOnWriteSliceLength && receiver->IsJSArray() &&
+        end == static_cast<uint32_t>(
+                   Smi::cast(JSArray::cast(*receiver)->length())->value())) {
+      // A slice of the whole array shares the backing store with the
+      // receiver. Both arrays copy it on their next write.
+      Isolate* isolate = receiver->GetIsolate();
+      Heap* heap = isolate->heap();
+      if (backing_store->map() == heap->fixed_array_map()) {
+        backing_store->set_map_no_write_barrier(heap->fixed_cow_array_map());
+      }
+      DCHECK_EQ(heap->fixed_cow_array_map(), backing_store->map());
+      return isolate->factory()->NewJSArrayWithElements(
+          backing_store, KindTraits::Kind, end);
+    }
+    return FastElementsAccessor<FastElementsAccessorSubclass,
+                                KindTraits>::SliceImpl(receiver, backing_store,
+                                                       start, end);
+  }
+
   static void MoveElements(Isolate* isolate, Handle<JSArray> receiver,
                            Handle<FixedArrayBase> backing_store, int dst_index,
                            int src_index, int len, int hole_start,
@@ -1622,7 +1659,13 @@ class FastSmiOrObjectElementsAccessor
       DCHECK_LE(hole_end, backing_store->length());
     } else if (len != 0) {
       DisallowHeapAllocation no_gc;
-      heap->MoveElements(*dst_elms, dst_index, src_index, len);
+      if (IsFastSmiElementsKind(KindTraits::Kind)) {
+        // Smis and holes need no write barriers, move them in one go.
+        MemMove(dst_elms->data_start() + dst_index,
+                dst_elms->data_start() + src_index, len * kPointerSize);
+      } else {
+        heap->MoveElements(*dst_elms, dst_index, src_index, len);
+      }
     }
     if (hole_start != hole_end) {
       dst_elms->FillWithHoles(hole_start, hole_end);
@@ -113,6 +113,19 @@ Factory::NewSloppyBlockWithEvalContextExtension(
 }
 
 
+Handle<PromiseReactionJobInfo> Factory::NewPromiseReactionJobInfo(
+    Handle<Object> value, Handle<JSArray> tasks, Handle<Context> context) {
+  DCHECK(context->IsNativeContext());
+  Handle<PromiseReactionJobInfo> result =
+      Handle<PromiseReactionJobInfo>::cast(
+          NewStruct(PROMISE_REACTION_JOB_INFO_TYPE));
+  result->set_value(*value);
+  result->set_tasks(*tasks);
+  result->set_context(*context);
+  return result;
+}
+
+
 Handle<Oddball> Factory::NewOddball(Handle<Map> map, const char* to_string,
                                     Handle<Object> to_number,
                                     const char* type_of, byte kind) {
@@ -880,6 +893,7 @@ Handle<Script> Factory::NewScript(Handle<String> source) {
   script->set_eval_from_instructions_offset(0);
   script->set_shared_function_infos(Smi::FromInt(0));
   script->set_flags(0);
+  script->set_preparse_data(heap->undefined_value());
 
   heap->set_script_list(*WeakFixedArray::Add(script_list(), script));
   return script;
@@ -58,6 +58,10 @@ class Factory final {
   NewSloppyBlockWithEvalContextExtension(Handle<ScopeInfo> scope_info,
                                          Handle<JSObject> extension);
 
+  // Create a new PromiseReactionJobInfo struct.
+  Handle<PromiseReactionJobInfo> NewPromiseReactionJobInfo(
+      Handle<Object> value, Handle<JSArray> tasks, Handle<Context> context);
+
   // Create a pre-tenured empty AccessorPair.
   Handle<AccessorPair> NewAccessorPair();
 
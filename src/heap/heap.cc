@@ -1461,6 +1461,7 @@ void Heap::MarkCompactPrologue() {
   isolate_->keyed_lookup_cache()->Clear();
   isolate_->context_slot_cache()->Clear();
   isolate_->descriptor_lookup_cache()->Clear();
+  isolate_->for_in_cache()->Clear();
   RegExpResultsCache::Clear(string_split_cache());
   RegExpResultsCache::Clear(regexp_multiple_cache());
 
@@ -2864,6 +2865,9 @@ void Heap::CreateInitialObjects() {
   // Initialize descriptor cache.
   isolate_->descriptor_lookup_cache()->Clear();
 
+  // Initialize for-in cache.
+  isolate_->for_in_cache()->Clear();
+
   // Initialize compilation cache.
   isolate_->compilation_cache()->Clear();
 }
@@ -6105,6 +6109,42 @@ void DescriptorLookupCache::Clear() {
 }
 
 
+int ForInCache::Hash(Map* map) {
+  // Uses only lower 32 bits if pointers are larger.
+  uint32_t map_hash =
+      static_cast<uint32_t>(reinterpret_cast<uintptr_t>(map)) >>
+      kPointerSizeLog2;
+  return map_hash % kLength;
+}
+
+
+FixedArray* ForInCache::Lookup(Map* map) {
+  Entry& entry = entries_[Hash(map)];
+  if (entry.map != map) return NULL;
+  if (entry.validity_cell->value() !=
+      Smi::FromInt(Map::kPrototypeChainValid)) {
+    entry.map = NULL;
+    return NULL;
+  }
+  return entry.keys;
+}
+
+
+void ForInCache::Update(Map* map, Cell* validity_cell, FixedArray* keys) {
+  DCHECK(!map->GetHeap()->InNewSpace(validity_cell));
+  DCHECK(!map->GetHeap()->InNewSpace(keys));
+  Entry& entry = entries_[Hash(map)];
+  entry.map = map;
+  entry.validity_cell = validity_cell;
+  entry.keys = keys;
+}
+
+
+void ForInCache::Clear() {
+  for (int index = 0; index < kLength; index++) entries_[index].map = NULL;
+}
+
+
 void Heap::ExternalStringTable::CleanUp() {
   int last = 0;
   for (int i = 0; i < new_space_strings_.length(); ++i) {
@@ -2499,6 +2499,43 @@ class DescriptorLookupCache {
 };
 
 
+// Cache for mapping a receiver map to the keys a for-in loop enumerates on
+// it, for receivers whose prototypes have enumerable properties and which
+// therefore cannot use the enum cache of the map alone. Entries are guarded
+// by the prototype chain validity cell of the map. The cached key arrays are
+// allocated in old space. Cleared at startup and prior to mark sweep
+// collection.
+class ForInCache {
+ public:
+  // Lookup the keys for |map|. If absent or stale, NULL is returned.
+  FixedArray* Lookup(Map* map);
+
+  // Update an element in the cache.
+  void Update(Map* map, Cell* validity_cell, FixedArray* keys);
+
+  // Clear the cache.
+  void Clear();
+
+  static const int kLength = 64;
+
+ private:
+  ForInCache() { Clear(); }
+
+  static inline int Hash(Map* map);
+
+  struct Entry {
+    Map* map;
+    Cell* validity_cell;
+    FixedArray* keys;
+  };
+
+  Entry entries_[kLength];
+
+  friend class Isolate;
+  DISALLOW_COPY_AND_ASSIGN(ForInCache);
+};
+
+
 // Abstract base class for checking whether a weak object should be retained.
 class WeakObjectRetainer {
  public:
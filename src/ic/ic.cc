@@ -1096,14 +1096,17 @@ Handle<Code> IC::ComputeHandler(LookupIterator* lookup, Handle<Object> value) {
   code = CompileHandler(lookup, value, flag);
   DCHECK(code->is_handler());
 
-  // TODO(mvstanton): we'd only like to cache code on the map when it's custom
-  // code compiled for this map, otherwise it's already cached in the global
-  // code
-  // cache. We are also guarding against installing code with flags that don't
-  // match the desired CacheHolderFlag computed above, which would lead to
-  // invalid lookups later.
-  if (code->type() != Code::NORMAL &&
-      Code::ExtractCacheHolderFromFlags(code->flags()) == flag) {
+  // Handlers that are code stubs, like LoadFieldStub and StoreFieldStub, only
+  // depend on the field index, representation or constant index encoded in
+  // their key. They are shared by all maps and already cached in the code
+  // stub cache, so only code compiled for this map is cached on the map. We
+  // are also guarding against installing code with flags that don't match
+  // the desired CacheHolderFlag computed above, which would lead to invalid
+  // lookups later.
+  if (CodeStub::GetMajorKey(*code) != CodeStub::NoCache) {
+    isolate()->counters()->ic_shared_handlers()->Increment();
+  } else if (code->type() != Code::NORMAL &&
+             Code::ExtractCacheHolderFromFlags(code->flags()) == flag) {
     Map::UpdateCodeCache(stub_holder_map, lookup->name(), code);
   }
 
@@ -11,12 +11,34 @@ namespace v8 {
 namespace internal {
 
 
-StubCache::StubCache(Isolate* isolate) : isolate_(isolate) {}
+StubCache::StubCache(Isolate* isolate)
+    : primary_table_bits_(PrimaryTableBitsForSize(isolate->stub_cache_size())),
+      secondary_table_bits_(primary_table_bits_ - kSecondaryTableBitsDelta),
+      isolate_(isolate) {
+  // The tables are allocated up front because their addresses are external
+  // references, which are needed before Initialize is called.
+  primary_ = NewArray<Entry>(primary_table_size());
+  secondary_ = NewArray<Entry>(secondary_table_size());
+}
+
+
+StubCache::~StubCache() {
+  DeleteArray(primary_);
+  DeleteArray(secondary_);
+}
+
+
+int StubCache::PrimaryTableBitsForSize(int size) {
+  if (size <= 0) return kDefaultPrimaryTableBits;
+  int bits = kMinPrimaryTableBits;
+  while (bits < kMaxPrimaryTableBits && (1 << bits) < size) bits++;
+  return bits;
+}
 
 
 void StubCache::Initialize() {
-  DCHECK(base::bits::IsPowerOfTwo32(kPrimaryTableSize));
-  DCHECK(base::bits::IsPowerOfTwo32(kSecondaryTableSize));
+  DCHECK(base::bits::IsPowerOfTwo32(primary_table_size()));
+  DCHECK(base::bits::IsPowerOfTwo32(secondary_table_size()));
   Clear();
 }
 
@@ -62,6 +84,7 @@ Code* StubCache::Set(Name* name, Map* map, Code* code) {
     int secondary_offset = SecondaryOffset(primary->key, old_flags, seed);
     Entry* secondary = entry(secondary_, secondary_offset);
     *secondary = *primary;
+    isolate()->counters()->megamorphic_stub_cache_collisions()->Increment();
   }
 
   // Update primary cache.
@@ -91,12 +114,12 @@ Code* StubCache::Get(Name* name, Map* map, Code::Flags flags) {
 
 void StubCache::Clear() {
   Code* empty = isolate_->builtins()->builtin(Builtins::kIllegal);
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < primary_table_size(); i++) {
     primary_[i].key = isolate()->heap()->empty_string();
     primary_[i].map = NULL;
     primary_[i].value = empty;
   }
-  for (int j = 0; j < kSecondaryTableSize; j++) {
+  for (int j = 0; j < secondary_table_size(); j++) {
     secondary_[j].key = isolate()->heap()->empty_string();
     secondary_[j].map = NULL;
     secondary_[j].value = empty;
@@ -108,7 +131,7 @@ void StubCache::CollectMatchingMaps(SmallMapList* types, Handle<Name> name,
                                     Code::Flags flags,
                                     Handle<Context> native_context,
                                     Zone* zone) {
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < primary_table_size(); i++) {
     if (primary_[i].key == *name) {
       Map* map = primary_[i].map;
       // Map can be NULL, if the stub is constant function call
@@ -123,7 +146,7 @@ void StubCache::CollectMatchingMaps(SmallMapList* types, Handle<Name> name,
     }
   }
 
-  for (int i = 0; i < kSecondaryTableSize; i++) {
+  for (int i = 0; i < secondary_table_size(); i++) {
     if (secondary_[i].key == *name) {
       Map* map = secondary_[i].map;
       // Map can be NULL, if the stub is constant function call
@@ -87,13 +87,32 @@ class StubCache {
 
   Isolate* isolate() { return isolate_; }
 
+  // The table sizes are fixed when the isolate is created and are baked
+  // into the generated probing code.
+  int primary_table_size() const { return 1 << primary_table_bits_; }
+  int secondary_table_size() const { return 1 << secondary_table_bits_; }
+
+  // Returns the number of bits of the primary table index for a requested
+  // number of entries, which is rounded up to a power of two and clamped to
+  // the supported range. Zero selects the default size.
+  static int PrimaryTableBitsForSize(int size);
+
   // Setting the entry size such that the index is shifted by Name::kHashShift
   // is convenient; shifting down the length field (to extract the hash code)
   // automatically discards the hash bit field.
   static const int kCacheIndexShift = Name::kHashShift;
 
+  static const int kDefaultPrimaryTableBits = 11;
+  static const int kMinPrimaryTableBits = 8;
+  // The masked primary offset has to fit the 16-bit unsigned immediate of
+  // the PPC andi instruction.
+  static const int kMaxPrimaryTableBits = 14;
+  // The secondary table has a quarter of the entries of the primary table.
+  static const int kSecondaryTableBitsDelta = 2;
+
  private:
   explicit StubCache(Isolate* isolate);
+  ~StubCache();
 
   // The stub cache has a primary and secondary level.  The two levels have
   // different hashing algorithms in order to avoid simultaneous collisions
@@ -105,7 +124,7 @@ class StubCache {
   // Hash algorithm for the primary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int PrimaryOffset(Name* name, Code::Flags flags, Map* map) {
+  int PrimaryOffset(Name* name, Code::Flags flags, Map* map) {
     STATIC_ASSERT(kCacheIndexShift == Name::kHashShift);
     // Compute the hash of the name (use entire hash field).
     DCHECK(name->HasHashCode());
@@ -121,13 +140,13 @@ class StubCache {
         (static_cast<uint32_t>(flags) & ~Code::kFlagsNotUsedInLookup);
     // Base the offset on a simple combination of name, flags, and map.
     uint32_t key = (map_low32bits + field) ^ iflags;
-    return key & ((kPrimaryTableSize - 1) << kCacheIndexShift);
+    return key & ((primary_table_size() - 1) << kCacheIndexShift);
   }
 
   // Hash algorithm for the secondary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int SecondaryOffset(Name* name, Code::Flags flags, int seed) {
+  int SecondaryOffset(Name* name, Code::Flags flags, int seed) {
     // Use the seed from the primary cache in the secondary cache.
     uint32_t name_low32bits =
         static_cast<uint32_t>(reinterpret_cast<uintptr_t>(name));
@@ -136,7 +155,7 @@ class StubCache {
     uint32_t iflags =
         (static_cast<uint32_t>(flags) & ~Code::kFlagsNotUsedInLookup);
     uint32_t key = (seed - name_low32bits) + iflags;
-    return key & ((kSecondaryTableSize - 1) << kCacheIndexShift);
+    return key & ((secondary_table_size() - 1) << kCacheIndexShift);
   }
 
   // Compute the entry for a given offset in exactly the same way as
@@ -150,14 +169,10 @@ class StubCache {
                                     offset * multiplier);
   }
 
-  static const int kPrimaryTableBits = 11;
-  static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
-  static const int kSecondaryTableBits = 9;
-  static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
-
- private:
-  Entry primary_[kPrimaryTableSize];
-  Entry secondary_[kSecondaryTableSize];
+  int primary_table_bits_;
+  int secondary_table_bits_;
+  Entry* primary_;
+  Entry* secondary_;
   Isolate* isolate_;
 
   friend class Isolate;
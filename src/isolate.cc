@@ -31,6 +31,7 @@
 #include "src/profiler/cpu-profiler.h"
 #include "src/profiler/sampler.h"
 #include "src/prototype.h"
+#include "src/regexp/regexp-nfa.h"
 #include "src/regexp/regexp-stack.h"
 #include "src/runtime-profiler.h"
 #include "src/simulator.h"
@@ -1778,6 +1779,7 @@ Isolate::Isolate(bool enable_serializer)
       keyed_lookup_cache_(NULL),
       context_slot_cache_(NULL),
       descriptor_lookup_cache_(NULL),
+      for_in_cache_(NULL),
       handle_scope_implementer_(NULL),
       unicode_cache_(NULL),
       inner_pointer_to_code_cache_(NULL),
@@ -1786,6 +1788,7 @@ Isolate::Isolate(bool enable_serializer)
       thread_manager_(NULL),
       has_installed_extensions_(false),
       regexp_stack_(NULL),
+      regexp_nfa_marks_(NULL),
       date_cache_(NULL),
       call_descriptor_data_(NULL),
       // TODO(bmeurer) Initialized lazily because it depends on flags; can
@@ -1990,6 +1993,11 @@ Isolate::~Isolate() {
   delete regexp_stack_;
   regexp_stack_ = NULL;
 
+  delete regexp_nfa_marks_;
+  regexp_nfa_marks_ = NULL;
+
+  delete for_in_cache_;
+  for_in_cache_ = NULL;
   delete descriptor_lookup_cache_;
   descriptor_lookup_cache_ = NULL;
   delete context_slot_cache_;
@@ -2142,6 +2150,7 @@ bool Isolate::Init(Deserializer* des) {
   keyed_lookup_cache_ = new KeyedLookupCache();
   context_slot_cache_ = new ContextSlotCache();
   descriptor_lookup_cache_ = new DescriptorLookupCache();
+  for_in_cache_ = new ForInCache();
   unicode_cache_ = new UnicodeCache();
   inner_pointer_to_code_cache_ = new InnerPointerToCodeCache(this);
   global_handles_ = new GlobalHandles(this);
@@ -2152,6 +2161,7 @@ bool Isolate::Init(Deserializer* des) {
   materialized_object_store_ = new MaterializedObjectStore(this);
   regexp_stack_ = new RegExpStack();
   regexp_stack_->isolate_ = this;
+  regexp_nfa_marks_ = new RegExpNfaMarks();
   date_cache_ = new DateCache();
   call_descriptor_data_ =
       new CallInterfaceDescriptorData[CallDescriptors::NUMBER_OF_DESCRIPTORS];
@@ -2686,7 +2696,8 @@ void Isolate::ReportPromiseReject(Handle<JSObject> promise,
 
 
 void Isolate::EnqueueMicrotask(Handle<Object> microtask) {
-  DCHECK(microtask->IsJSFunction() || microtask->IsCallHandlerInfo());
+  DCHECK(microtask->IsJSFunction() || microtask->IsCallHandlerInfo() ||
+         microtask->IsPromiseReactionJobInfo());
   Handle<FixedArray> queue(heap()->microtask_queue(), this);
   int num_tasks = pending_microtask_count();
   DCHECK(num_tasks <= queue->length());
@@ -2719,30 +2730,45 @@ void Isolate::RunMicrotasks() {
     for (int i = 0; i < num_tasks; i++) {
       HandleScope scope(this);
       Handle<Object> microtask(queue->get(i), this);
-      if (microtask->IsJSFunction()) {
-        Handle<JSFunction> microtask_function =
-            Handle<JSFunction>::cast(microtask);
-        SaveContext save(this);
-        set_context(microtask_function->context()->native_context());
-        MaybeHandle<Object> maybe_exception;
-        MaybeHandle<Object> result = Execution::TryCall(
-            this, microtask_function, factory()->undefined_value(), 0, NULL,
-            &maybe_exception);
-        // If execution is terminating, just bail out.
-        Handle<Object> exception;
-        if (result.is_null() && maybe_exception.is_null()) {
-          // Clear out any remaining callbacks in the queue.
-          heap()->set_microtask_queue(heap()->empty_fixed_array());
-          set_pending_microtask_count(0);
-          return;
-        }
-      } else {
+      if (microtask->IsCallHandlerInfo()) {
         Handle<CallHandlerInfo> callback_info =
             Handle<CallHandlerInfo>::cast(microtask);
         v8::MicrotaskCallback callback =
             v8::ToCData<v8::MicrotaskCallback>(callback_info->callback());
         void* data = v8::ToCData<void*>(callback_info->data());
         callback(data);
+        continue;
+      }
+
+      SaveContext save(this);
+      MaybeHandle<Object> maybe_exception;
+      MaybeHandle<Object> result;
+      if (microtask->IsJSFunction()) {
+        Handle<JSFunction> microtask_function =
+            Handle<JSFunction>::cast(microtask);
+        set_context(microtask_function->context()->native_context());
+        result = Execution::TryCall(this, microtask_function,
+                                    factory()->undefined_value(), 0, NULL,
+                                    &maybe_exception);
+      } else {
+        // Run the reactions of a settled promise in the context the promise
+        // was settled in.
+        Handle<PromiseReactionJobInfo> info =
+            Handle<PromiseReactionJobInfo>::cast(microtask);
+        Handle<Context> native_context(info->context(), this);
+        set_context(*native_context);
+        Handle<JSFunction> job(native_context->promise_reaction_job(), this);
+        Handle<Object> argv[] = {handle(info->value(), this),
+                                 handle(info->tasks(), this)};
+        result = Execution::TryCall(this, job, factory()->undefined_value(),
+                                    arraysize(argv), argv, &maybe_exception);
+      }
+      // If execution is terminating, just bail out.
+      if (result.is_null() && maybe_exception.is_null()) {
+        // Clear out any remaining callbacks in the queue.
+        heap()->set_microtask_queue(heap()->empty_fixed_array());
+        set_pending_microtask_count(0);
+        return;
       }
     }
   }
@@ -67,6 +67,7 @@ class InnerPointerToCodeCache;
 class Logger;
 class MaterializedObjectStore;
 class CodeAgingHelper;
+class RegExpNfaMarks;
 class RegExpStack;
 class SaveContext;
 class StatsTable;
@@ -387,6 +388,10 @@ typedef List<HeapObject*> DebugObjectCache;
   V(uint32_t, per_isolate_assert_data, 0xFFFFFFFFu)                            \
   V(PromiseRejectCallback, promise_reject_callback, NULL)                      \
   V(const v8::StartupData*, snapshot_blob, NULL)                               \
+  V(v8::ScriptCompiler::CodeCacheBackingStore*, code_cache_backing_store,      \
+    NULL)                                                                      \
+  /* Requested number of primary stub cache entries, or 0 for the default. */ \
+  V(int, stub_cache_size, 0)                                                   \
   ISOLATE_INIT_SIMULATOR_LIST(V)
 
 #define THREAD_LOCAL_TOP_ACCESSOR(type, name)                        \
@@ -843,6 +848,8 @@ class Isolate {
     return descriptor_lookup_cache_;
   }
 
+  ForInCache* for_in_cache() { return for_in_cache_; }
+
   HandleScopeData* handle_scope_data() { return &handle_scope_data_; }
 
   HandleScopeImplementer* handle_scope_implementer() {
@@ -891,6 +898,8 @@ class Isolate {
 
   RegExpStack* regexp_stack() { return regexp_stack_; }
 
+  RegExpNfaMarks* regexp_nfa_marks() { return regexp_nfa_marks_; }
+
   unibrow::Mapping<unibrow::Ecma262Canonicalize>*
       interp_canonicalize_mapping() {
     return &regexp_macro_assembler_canonicalize_;
@@ -1234,6 +1243,7 @@ class Isolate {
   KeyedLookupCache* keyed_lookup_cache_;
   ContextSlotCache* context_slot_cache_;
   DescriptorLookupCache* descriptor_lookup_cache_;
+  ForInCache* for_in_cache_;
   HandleScopeData handle_scope_data_;
   HandleScopeImplementer* handle_scope_implementer_;
   UnicodeCache* unicode_cache_;
@@ -1251,6 +1261,7 @@ class Isolate {
   unibrow::Mapping<unibrow::Ecma262Canonicalize>
       regexp_macro_assembler_canonicalize_;
   RegExpStack* regexp_stack_;
+  RegExpNfaMarks* regexp_nfa_marks_;
   DateCache* date_cache_;
   CallInterfaceDescriptorData* call_descriptor_data_;
   base::RandomNumberGenerator* random_number_generator_;
@@ -1357,6 +1357,11 @@ function InnerArrayIndexOf(array, element, index, length) {
   }
   var min = index;
   var max = length;
+  if (IS_ARRAY(array)) {
+    // Search fast elements directly, without going through HasProperty.
+    var found = %ArraySearchFastElements(array, element, min, max, false);
+    if (!IS_UNDEFINED(found)) return found;
+  }
   if (UseSparseVariant(array, length, IS_ARRAY(array), max - min)) {
     %NormalizeElements(array);
     var indices = %GetArrayKeys(array, length);
@@ -1712,6 +1717,13 @@ function InnerArrayIncludes(searchElement, fromIndex, array, length) {
     }
   }
 
+  if (IS_ARRAY(array)) {
+    // Search fast elements directly, without going through HasProperty.
+    var found = %ArraySearchFastElements(array, searchElement, k, length,
+                                         true);
+    if (!IS_UNDEFINED(found)) return found >= 0;
+  }
+
   while (k < length) {
     var elementK = array[k];
     if (%SameValueZero(searchElement, elementK)) {
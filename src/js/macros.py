@@ -236,6 +236,11 @@ macro ORDERED_HASH_MAP_CHAIN_AT(table, entry, numBuckets) = (FIXED_ARRAY_GET(tab
 # Must match OrderedHashTable::kNotFound.
 define NOT_FOUND = -1;
 
+# Must match HashTable<> and ObjectHashTableShape in objects.h.
+macro OBJECT_HASH_TABLE_CAPACITY(table) = (FIXED_ARRAY_GET(table, 2));
+macro OBJECT_HASH_TABLE_KEY_AT(table, entry) = (FIXED_ARRAY_GET(table, 3 + ((entry) << 1)));
+macro OBJECT_HASH_TABLE_VALUE_AT(table, entry) = (FIXED_ARRAY_GET(table, 4 + ((entry) << 1)));
+
 # Check whether debug is active.
 define DEBUG_IS_ACTIVE = (%_DebugIsActive() != 0);
 macro DEBUG_PREPARE_STEP_IN_IF_STEPPING(function) = if (%_DebugIsActive() != 0) %DebugPrepareStepInIfStepping(function);
@@ -127,8 +127,21 @@ function PromiseHandle(value, handler, deferred) {
   }
 }
 
+// Runs the reactions of a settled promise. Called from the microtask queue
+// with the value the promise was settled with.
+function PromiseReactionJob(value, tasks) {
+  for (var i = 0; i < tasks.length; i += 2) {
+    PromiseHandle(value, tasks[i], tasks[i + 1])
+  }
+}
+
 function PromiseEnqueue(value, tasks, status) {
   var id, name, instrumenting = DEBUG_IS_ACTIVE;
+  if (!instrumenting) {
+    // Enqueue the reactions as data, without allocating a closure.
+    %EnqueuePromiseReactionJob(value, tasks);
+    return;
+  }
   %EnqueueMicrotask(function() {
     if (instrumenting) {
       %DebugAsyncTaskEvent({ type: "willHandle", id: id, name: name });
@@ -453,6 +466,7 @@ utils.InstallFunctions(GlobalPromise.prototype, DONT_ENUM, [
   "promise_chain", PromiseChain,
   "promise_create", PromiseCreate,
   "promise_has_user_defined_reject_handler", PromiseHasUserDefinedRejectHandler,
+  "promise_reaction_job", PromiseReactionJob,
   "promise_reject", PromiseReject,
   "promise_resolve", PromiseResolve,
   "promise_then", PromiseThen,
@@ -326,6 +326,11 @@ function RegExpSplit(string, limit) {
     return [subject];
   }
 
+  // Without the sticky flag all matches are found in one go in the runtime.
+  if (!REGEXP_STICKY(separator)) {
+    return %RegExpSplit(separator, subject, limit, RegExpLastMatchInfo);
+  }
+
   var currentIndex = 0;
   var startIndex = 0;
   var startMatch = 0;
@@ -453,17 +458,25 @@ function StringReplaceGlobalRegExpWithFunction(subject, regexp, replace) {
       }
     }
   } else {
-    for (var i = 0; i < len; i++) {
+    // Each match is followed by its captures, its index and the subject,
+    // which are passed to the callback in place. The results are compacted
+    // into the front of the array.
+    var argc = (NUMBER_OF_CAPTURES(RegExpLastMatchInfo) >> 1) + 2;
+    var j = 0;
+    for (var i = 0; i < len; ) {
       var elem = res[i];
-      if (!%_IsSmi(elem)) {
-        // elem must be an Array.
-        // Use the apply argument as backing for global RegExp properties.
-        var func_result = %Apply(replace, UNDEFINED, elem, 0, elem.length);
-        // Overwrite the i'th element in the results with the string we got
-        // back from the callback function.
-        res[i] = TO_STRING(func_result);
+      if (%_IsSmi(elem)) {
+        // Slices of the original string take one or two elements.
+        res[j++] = elem;
+        i++;
+        if (elem <= 0) res[j++] = res[i++];
+        continue;
       }
+      var func_result = %Apply(replace, UNDEFINED, res, i, argc);
+      res[j++] = TO_STRING(func_result);
+      i += argc;
     }
+    len = j;
   }
   var result = %StringBuilderConcat(res, len, subject);
   resultArray.length = 0;
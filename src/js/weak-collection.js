@@ -25,6 +25,25 @@ utils.Import(function(from) {
   MakeTypeError = from.MakeTypeError;
 });
 
+// -------------------------------------------------------------------
+
+// Probes the ObjectHashTable of a weak collection the same way as
+// HashTable::FindEntry. Keys are receivers, so they match by identity;
+// deleted and collected entries hold the hole and never match.
+function WeakCollectionFindEntry(table, key, hash) {
+  var mask = OBJECT_HASH_TABLE_CAPACITY(table) - 1;
+  var entry = hash & mask;
+  var count = 1;
+  while (true) {
+    var candidate = OBJECT_HASH_TABLE_KEY_AT(table, entry);
+    if (candidate === key) return entry;
+    if (IS_UNDEFINED(candidate)) return NOT_FOUND;
+    entry = (entry + count++) & mask;
+  }
+}
+%SetForceInlineFlag(WeakCollectionFindEntry);
+
+
 // -------------------------------------------------------------------
 // Harmony WeakMap
 
@@ -58,7 +77,10 @@ function WeakMapGet(key) {
   if (!IS_RECEIVER(key)) return UNDEFINED;
   var hash = GetExistingHash(key);
   if (IS_UNDEFINED(hash)) return UNDEFINED;
-  return %WeakCollectionGet(this, key, hash);
+  var table = %_JSCollectionGetTable(this);
+  var entry = WeakCollectionFindEntry(table, key, hash);
+  if (entry === NOT_FOUND) return UNDEFINED;
+  return OBJECT_HASH_TABLE_VALUE_AT(table, entry);
 }
 
 
@@ -80,7 +102,8 @@ function WeakMapHas(key) {
   if (!IS_RECEIVER(key)) return false;
   var hash = GetExistingHash(key);
   if (IS_UNDEFINED(hash)) return false;
-  return %WeakCollectionHas(this, key, hash);
+  var table = %_JSCollectionGetTable(this);
+  return WeakCollectionFindEntry(table, key, hash) !== NOT_FOUND;
 }
 
 
@@ -154,7 +177,8 @@ function WeakSetHas(value) {
   if (!IS_RECEIVER(value)) return false;
   var hash = GetExistingHash(value);
   if (IS_UNDEFINED(hash)) return false;
-  return %WeakCollectionHas(this, value, hash);
+  var table = %_JSCollectionGetTable(this);
+  return WeakCollectionFindEntry(table, value, hash) !== NOT_FOUND;
 }
 
 
@@ -6,6 +6,7 @@
 #define V8_JSON_PARSER_H_
 
 #include "src/char-predicates.h"
+#include "src/code-unit-word.h"
 #include "src/conversions.h"
 #include "src/debug/debug.h"
 #include "src/factory.h"
@@ -21,6 +22,38 @@ namespace internal {
 enum ParseElementResult { kElementFound, kElementNotFound, kNullHandle };
 
 
+// Throws the SyntaxError for the unexpected character |c0| at |position| of
+// |source|. |c0| is JsonParser::kEndOfString if the input ended early.
+MaybeHandle<Object> ThrowJsonParseError(Isolate* isolate, Handle<String> source,
+                                        int position, uc32 c0);
+
+
+// Characters which need no attention inside a JSON string: anything but
+// control characters, the quote and the backslash.
+struct JsonStringCharacterRun {
+  bool Accepts(uint16_t c) const { return c >= 0x20 && c != '"' && c != '\\'; }
+  template <typename Char>
+  bool Rejects(uintptr_t word) const {
+    typedef CodeUnitWord<Char> Word;
+    return Word::AnyLessThan(word, 0x20) || Word::AnyEquals(word, '"') ||
+           Word::AnyEquals(word, '\\');
+  }
+};
+
+
+// JSON whitespace. Only words consisting of spaces, as found in indentation,
+// are skipped at once.
+struct JsonWhitespaceRun {
+  bool Accepts(uint16_t c) const {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+  }
+  template <typename Char>
+  bool Rejects(uintptr_t word) const {
+    return word != CodeUnitWord<Char>::kLowBits * ' ';
+  }
+};
+
+
 // A simple json parser.
 template <bool seq_one_byte>
 class JsonParser BASE_EMBEDDED {
@@ -68,17 +101,33 @@ class JsonParser BASE_EMBEDDED {
   // are tab, carriage-return, newline and space.
 
   inline void AdvanceSkipWhitespace() {
-    do {
-      Advance();
-    } while (c0_ == ' ' || c0_ == '\t' || c0_ == '\n' || c0_ == '\r');
+    Advance();
+    SkipWhitespace();
   }
 
   inline void SkipWhitespace() {
+    if (seq_one_byte) {
+      if (!JsonWhitespaceRun().Accepts(c0_)) return;
+      position_ += PrefixLength(JsonWhitespaceRun(), position_) - 1;
+      Advance();
+      return;
+    }
     while (c0_ == ' ' || c0_ == '\t' || c0_ == '\n' || c0_ == '\r') {
       Advance();
     }
   }
 
+  // Returns the length of the run of |Run| characters starting at |position|
+  // of the one-byte source.
+  template <typename Run>
+  inline int PrefixLength(const Run& run, int position) {
+    DCHECK(seq_one_byte);
+    DisallowHeapAllocation no_gc;
+    Vector<const uint8_t> chars(seq_source_->GetChars() + position,
+                                source_length_ - position);
+    return WordwisePrefixLength(run, chars);
+  }
+
   inline uc32 AdvanceGetChar() {
     Advance();
     return c0_;
@@ -217,45 +266,7 @@ MaybeHandle<Object> JsonParser<seq_one_byte>::ParseJson() {
     if (isolate_->has_pending_exception()) return Handle<Object>::null();
 
     // Parse failed. Current character is the unexpected token.
-    Factory* factory = this->factory();
-    MessageTemplate::Template message;
-    Handle<Object> arg1 = Handle<Smi>(Smi::FromInt(position_), isolate());
-    Handle<Object> arg2;
-
-    switch (c0_) {
-      case kEndOfString:
-        message = MessageTemplate::kJsonParseUnexpectedEOS;
-        break;
-      case '-':
-      case '0':
-      case '1':
-      case '2':
-      case '3':
-      case '4':
-      case '5':
-      case '6':
-      case '7':
-      case '8':
-      case '9':
-        message = MessageTemplate::kJsonParseUnexpectedTokenNumber;
-        break;
-      case '"':
-        message = MessageTemplate::kJsonParseUnexpectedTokenString;
-        break;
-      default:
-        message = MessageTemplate::kJsonParseUnexpectedToken;
-        arg2 = arg1;
-        arg1 = factory->LookupSingleCharacterStringFromCode(c0_);
-        break;
-    }
-
-    Handle<Script> script(factory->NewScript(source_));
-    // We should sent compile error event because we compile JSON object in
-    // separated source file.
-    isolate()->debug()->OnCompileError(script);
-    MessageLocation location(script, position_, position_ + 1);
-    Handle<Object> error = factory->NewSyntaxError(message, arg1, arg2);
-    return isolate()->template Throw<Object>(error, &location);
+    return ThrowJsonParseError(isolate(), source_, position_, c0_);
   }
   return result;
 }
@@ -752,26 +763,27 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
     // Fast path for existing internalized strings.  If the the string being
     // parsed is not a known internalized string, contains backslashes or
     // unexpectedly reaches the end of string, return with an empty handle.
+    int position =
+        position_ + PrefixLength(JsonStringCharacterRun(), position_);
+    if (position >= source_length_) return Handle<String>::null();
+    uc32 c0 = seq_source_->SeqOneByteStringGet(position);
+    if (c0 == '\\') {
+      c0_ = c0;
+      int beg_pos = position_;
+      position_ = position;
+      return SlowScanJsonString<SeqOneByteString, uint8_t>(source_, beg_pos,
+                                                           position_);
+    }
+    if (c0 != '"') return Handle<String>::null();
+    int length = position - position_;
     uint32_t running_hash = isolate()->heap()->HashSeed();
-    int position = position_;
-    uc32 c0 = c0_;
-    do {
-      if (c0 == '\\') {
-        c0_ = c0;
-        int beg_pos = position_;
-        position_ = position;
-        return SlowScanJsonString<SeqOneByteString, uint8_t>(source_,
-                                                             beg_pos,
-                                                             position_);
+    {
+      DisallowHeapAllocation no_gc;
+      const uint8_t* chars = seq_source_->GetChars() + position_;
+      for (int i = 0; i < length; i++) {
+        running_hash = StringHasher::AddCharacterCore(running_hash, chars[i]);
       }
-      if (c0 < 0x20) return Handle<String>::null();
-      running_hash = StringHasher::AddCharacterCore(running_hash,
-                                                    static_cast<uint16_t>(c0));
-      position++;
-      if (position >= source_length_) return Handle<String>::null();
-      c0 = seq_source_->SeqOneByteStringGet(position);
-    } while (c0 != '"');
-    int length = position - position_;
+    }
     uint32_t hash = (length <= String::kMaxHashCalcLength)
                         ? StringHasher::GetHashCore(running_hash)
                         : static_cast<uint32_t>(length);
@@ -810,8 +822,13 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
   }
 
   int beg_pos = position_;
+  if (seq_one_byte) {
+    // Skip the characters which need no attention at once.
+    position_ += PrefixLength(JsonStringCharacterRun(), position_) - 1;
+    Advance();
+  }
   // Fast case for Latin1 only without escape characters.
-  do {
+  while (c0_ != '"') {
     // Check for control character (0x00-0x1f) or unterminated string (<0).
     if (c0_ < 0x20) return Handle<String>::null();
     if (c0_ != '\\') {
@@ -827,7 +844,7 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
                                                            beg_pos,
                                                            position_);
     }
-  } while (c0_ != '"');
+  }
   int length = position_ - beg_pos;
   Handle<String> result =
       factory()->NewRawOneByteString(length, pretenure_).ToHandleChecked();
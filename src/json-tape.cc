@@ -0,0 +1,644 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/json-tape.h"
+
+#include "src/char-predicates-inl.h"
+#include "src/conversions.h"
+#include "src/json-parser.h"
+#include "src/objects-inl.h"
+
+namespace v8 {
+namespace internal {
+
+// Tokenizes and validates a JSON text into a JsonTape. The grammar and the
+// error positions follow JsonParser; see there for the productions.
+template <typename Char>
+class JsonTapeBuilder BASE_EMBEDDED {
+ public:
+  JsonTapeBuilder(JsonTape* tape, const Char* source, uintptr_t stack_limit)
+      : tape_(tape),
+        source_(source),
+        source_length_(tape->source_length()),
+        stack_limit_(stack_limit),
+        c0_(kEndOfString),
+        position_(-1) {}
+
+  void Build() {
+    AdvanceSkipWhitespace();
+    if (ParseValue() && c0_ == kEndOfString) {
+      tape_->state_ = JsonTape::kParsed;
+      return;
+    }
+    if (tape_->state_ == JsonTape::kNotParsed) {
+      tape_->state_ = JsonTape::kSyntaxError;
+      tape_->error_position_ = position_;
+      tape_->error_character_ = c0_;
+    }
+  }
+
+ private:
+  static const int kEndOfString = JsonParser<true>::kEndOfString;
+  // The cancellation flag is checked once per this many values.
+  static const int kCancellationCheckInterval = 4096;
+
+  inline void Advance() {
+    position_++;
+    c0_ = position_ < source_length_ ? source_[position_] : kEndOfString;
+  }
+
+  inline void AdvanceSkipWhitespace() {
+    do {
+      Advance();
+    } while (c0_ == ' ' || c0_ == '\t' || c0_ == '\n' || c0_ == '\r');
+  }
+
+  inline void SkipWhitespace() {
+    while (c0_ == ' ' || c0_ == '\t' || c0_ == '\n' || c0_ == '\r') {
+      Advance();
+    }
+  }
+
+  inline bool MatchSkipWhiteSpace(uc32 c) {
+    if (c0_ == c) {
+      AdvanceSkipWhitespace();
+      return true;
+    }
+    return false;
+  }
+
+  int AddEntry(JsonTape::Type type, int length, uint32_t payload,
+               bool one_byte = false) {
+    JsonTape::Entry entry = {type, one_byte, length, payload};
+    tape_->entries_.Add(entry, &tape_->zone_);
+    return tape_->entries_.length() - 1;
+  }
+
+  bool ParseValue();
+  bool ParseKeyword(const char* rest, JsonTape::Type type);
+  bool ParseString(bool is_key);
+  bool ParseEscapedString(int start, bool one_byte);
+  bool ParseNumber();
+  bool ParseObject();
+  bool ParseArray();
+  bool IsArrayIndex(int start, int length, uint32_t* index);
+
+  JsonTape* tape_;
+  const Char* source_;
+  int source_length_;
+  uintptr_t stack_limit_;
+  uc32 c0_;
+  int position_;
+};
+
+
+template <typename Char>
+bool JsonTapeBuilder<Char>::ParseValue() {
+  if (GetCurrentStackPosition() < stack_limit_) {
+    tape_->state_ = JsonTape::kStackOverflow;
+    return false;
+  }
+  if (tape_->entries_.length() % kCancellationCheckInterval == 0 &&
+      tape_->cancelled()) {
+    tape_->state_ = JsonTape::kCancelled;
+    return false;
+  }
+
+  if (c0_ == '"') return ParseString(false);
+  if ((c0_ >= '0' && c0_ <= '9') || c0_ == '-') return ParseNumber();
+  if (c0_ == '{') return ParseObject();
+  if (c0_ == '[') return ParseArray();
+  if (c0_ == 'f') return ParseKeyword("alse", JsonTape::kFalse);
+  if (c0_ == 't') return ParseKeyword("rue", JsonTape::kTrue);
+  if (c0_ == 'n') return ParseKeyword("ull", JsonTape::kNull);
+  return false;
+}
+
+
+template <typename Char>
+bool JsonTapeBuilder<Char>::ParseKeyword(const char* rest,
+                                         JsonTape::Type type) {
+  for (const char* p = rest; *p != '\0'; p++) {
+    Advance();
+    if (c0_ != *p) return false;
+  }
+  AdvanceSkipWhitespace();
+  AddEntry(type, 0, 0);
+  return true;
+}
+
+
+template <typename Char>
+bool JsonTapeBuilder<Char>::ParseString(bool is_key) {
+  DCHECK_EQ('"', c0_);
+  Advance();
+  int start = position_;
+  bool one_byte = true;
+  while (c0_ != '"') {
+    // Check for control character (0x00-0x1f) or unterminated string (<0).
+    if (c0_ < 0x20) return false;
+    if (c0_ == '\\') return ParseEscapedString(start, one_byte);
+    if (sizeof(Char) != 1 && c0_ > String::kMaxOneByteCharCode) {
+      one_byte = false;
+    }
+    Advance();
+  }
+  int length = position_ - start;
+  uint32_t index;
+  if (is_key && IsArrayIndex(start, length, &index)) {
+    AddEntry(JsonTape::kIndexKey, 0, index);
+  } else {
+    AddEntry(JsonTape::kSourceString, length, start, one_byte);
+  }
+  // Advance past the last '"'.
+  AdvanceSkipWhitespace();
+  return true;
+}
+
+
+// Copies source[start..position_] to the decoded characters and decodes the
+// rest of the string there.
+template <typename Char>
+bool JsonTapeBuilder<Char>::ParseEscapedString(int start, bool one_byte) {
+  Zone* zone = &tape_->zone_;
+  ZoneList<uc16>* decoded = &tape_->decoded_chars_;
+  int offset = decoded->length();
+  for (int i = start; i < position_; i++) decoded->Add(source_[i], zone);
+
+  while (c0_ != '"') {
+    if (c0_ < 0x20) return false;
+    uc32 c = c0_;
+    if (c0_ == '\\') {
+      Advance();  // Advance past the \.
+      switch (c0_) {
+        case '"':
+        case '\\':
+        case '/':
+          c = c0_;
+          break;
+        case 'b':
+          c = '\x08';
+          break;
+        case 'f':
+          c = '\x0c';
+          break;
+        case 'n':
+          c = '\x0a';
+          break;
+        case 'r':
+          c = '\x0d';
+          break;
+        case 't':
+          c = '\x09';
+          break;
+        case 'u':
+          c = 0;
+          for (int i = 0; i < 4; i++) {
+            Advance();
+            int digit = HexValue(c0_);
+            if (digit < 0) return false;
+            c = c * 16 + digit;
+          }
+          break;
+        default:
+          return false;
+      }
+    }
+    if (c > String::kMaxOneByteCharCode) one_byte = false;
+    decoded->Add(static_cast<uc16>(c), zone);
+    Advance();
+  }
+  AddEntry(JsonTape::kDecodedString, decoded->length() - offset, offset,
+           one_byte);
+  // Advance past the last '"'.
+  AdvanceSkipWhitespace();
+  return true;
+}
+
+
+// Keys which are array indices are added as elements, see
+// JsonParser::ParseElement.
+template <typename Char>
+bool JsonTapeBuilder<Char>::IsArrayIndex(int start, int length,
+                                         uint32_t* index) {
+  if (length == 0 || !IsDecimalDigit(source_[start])) return false;
+  if (source_[start] == '0') {
+    // With a leading zero, the string has to be "0" only to be an index.
+    *index = 0;
+    return length == 1;
+  }
+  uint32_t value = 0;
+  for (int i = start; i < start + length; i++) {
+    if (!IsDecimalDigit(source_[i])) return false;
+    int d = source_[i] - '0';
+    if (value > 429496729U - ((d + 3) >> 3)) return false;
+    value = (value * 10) + d;
+  }
+  *index = value;
+  return true;
+}
+
+
+template <typename Char>
+bool JsonTapeBuilder<Char>::ParseNumber() {
+  bool negative = false;
+  int beg_pos = position_;
+  if (c0_ == '-') {
+    Advance();
+    negative = true;
+  }
+  if (c0_ == '0') {
+    Advance();
+    // Prefix zero is only allowed if it's the only digit before
+    // a decimal point or exponent.
+    if (IsDecimalDigit(c0_)) return false;
+  } else {
+    int i = 0;
+    int digits = 0;
+    if (c0_ < '1' || c0_ > '9') return false;
+    do {
+      i = i * 10 + c0_ - '0';
+      digits++;
+      Advance();
+    } while (IsDecimalDigit(c0_));
+    if (c0_ != '.' && c0_ != 'e' && c0_ != 'E' && digits < 10) {
+      SkipWhitespace();
+      AddEntry(JsonTape::kSmi, 0, static_cast<uint32_t>(negative ? -i : i));
+      return true;
+    }
+  }
+  if (c0_ == '.') {
+    Advance();
+    if (!IsDecimalDigit(c0_)) return false;
+    do {
+      Advance();
+    } while (IsDecimalDigit(c0_));
+  }
+  if (AsciiAlphaToLower(c0_) == 'e') {
+    Advance();
+    if (c0_ == '-' || c0_ == '+') Advance();
+    if (!IsDecimalDigit(c0_)) return false;
+    do {
+      Advance();
+    } while (IsDecimalDigit(c0_));
+  }
+  Vector<const Char> chars(source_ + beg_pos, position_ - beg_pos);
+  double number = StringToDouble(&tape_->unicode_cache_, chars, NO_FLAGS);
+  tape_->numbers_.Add(number, &tape_->zone_);
+  AddEntry(JsonTape::kNumber, 0, tape_->numbers_.length() - 1);
+  SkipWhitespace();
+  return true;
+}
+
+
+template <typename Char>
+bool JsonTapeBuilder<Char>::ParseObject() {
+  DCHECK_EQ('{', c0_);
+  int object_entry = AddEntry(JsonTape::kObject, 0, 0);
+  int length = 0;
+  AdvanceSkipWhitespace();
+  if (c0_ != '}') {
+    do {
+      if (c0_ != '"') return false;
+      if (!ParseString(true)) return false;
+      if (c0_ != ':') return false;
+      AdvanceSkipWhitespace();
+      if (!ParseValue()) return false;
+      length++;
+    } while (MatchSkipWhiteSpace(','));
+    if (c0_ != '}') return false;
+  }
+  AdvanceSkipWhitespace();
+  tape_->entries_[object_entry].length = length;
+  return true;
+}
+
+
+template <typename Char>
+bool JsonTapeBuilder<Char>::ParseArray() {
+  DCHECK_EQ('[', c0_);
+  int array_entry = AddEntry(JsonTape::kArray, 0, 0);
+  int length = 0;
+  AdvanceSkipWhitespace();
+  if (c0_ != ']') {
+    do {
+      if (!ParseValue()) return false;
+      length++;
+    } while (MatchSkipWhiteSpace(','));
+    if (c0_ != ']') return false;
+  }
+  AdvanceSkipWhitespace();
+  tape_->entries_[array_entry].length = length;
+  return true;
+}
+
+
+JsonTape::JsonTape(const uint8_t* one_byte_source, int length)
+    : entries_(length / 16 + 16, &zone_),
+      numbers_(16, &zone_),
+      decoded_chars_(16, &zone_),
+      one_byte_source_(one_byte_source),
+      two_byte_source_(NULL),
+      source_length_(length),
+      state_(kNotParsed),
+      cancelled_(false),
+      error_position_(0),
+      error_character_(0) {}
+
+
+JsonTape::JsonTape(const uint16_t* two_byte_source, int length)
+    : entries_(length / 16 + 16, &zone_),
+      numbers_(16, &zone_),
+      decoded_chars_(16, &zone_),
+      one_byte_source_(NULL),
+      two_byte_source_(two_byte_source),
+      source_length_(length),
+      state_(kNotParsed),
+      cancelled_(false),
+      error_position_(0),
+      error_character_(0) {}
+
+
+void JsonTape::Parse(uintptr_t stack_limit) {
+  DCHECK_EQ(kNotParsed, state_);
+  if (is_one_byte_source()) {
+    JsonTapeBuilder<uint8_t>(this, one_byte_source_, stack_limit).Build();
+  } else {
+    JsonTapeBuilder<uint16_t>(this, two_byte_source_, stack_limit).Build();
+  }
+  DCHECK_NE(kNotParsed, state_);
+}
+
+
+JsonTapeMaterializer::JsonTapeMaterializer(Isolate* isolate,
+                                           const JsonTape* tape)
+    : isolate_(isolate),
+      factory_(isolate->factory()),
+      tape_(tape),
+      object_constructor_(isolate->native_context()->object_function(),
+                          isolate),
+      pretenure_(tape->source_length() >= kPretenureTreshold ? TENURED
+                                                             : NOT_TENURED),
+      cursor_(0) {}
+
+
+MaybeHandle<Object> JsonTapeMaterializer::Materialize(Isolate* isolate,
+                                                      const JsonTape* tape) {
+  switch (tape->state()) {
+    case JsonTape::kParsed:
+      break;
+    case JsonTape::kSyntaxError: {
+      // The source string is only needed for the error message.
+      Handle<String> source;
+      MaybeHandle<String> maybe_source =
+          tape->is_one_byte_source()
+              ? isolate->factory()->NewStringFromOneByte(
+                    tape->OneByteSourceChars(0, tape->source_length()))
+              : isolate->factory()->NewStringFromTwoByte(
+                    tape->TwoByteSourceChars(0, tape->source_length()));
+      if (!maybe_source.ToHandle(&source)) return MaybeHandle<Object>();
+      return ThrowJsonParseError(isolate, source, tape->error_position(),
+                                 tape->error_character());
+    }
+    case JsonTape::kStackOverflow:
+      isolate->StackOverflow();
+      return MaybeHandle<Object>();
+    case JsonTape::kNotParsed:
+    case JsonTape::kCancelled:
+      UNREACHABLE();
+  }
+
+  JsonTapeMaterializer materializer(isolate, tape);
+  Handle<Object> result = materializer.MaterializeValue();
+  if (result.is_null()) return MaybeHandle<Object>();
+  DCHECK_EQ(tape->length(), materializer.cursor_);
+  return result;
+}
+
+
+Handle<Object> JsonTapeMaterializer::MaterializeValue() {
+  StackLimitCheck stack_check(isolate_);
+  if (stack_check.HasOverflowed()) {
+    isolate_->StackOverflow();
+    return Handle<Object>::null();
+  }
+
+  if (stack_check.InterruptRequested()) {
+    ExecutionAccess access(isolate_);
+    // Avoid blocking GC while materializing large values.
+    isolate_->stack_guard()->HandleGCInterrupt();
+  }
+
+  const JsonTape::Entry& entry = tape_->entry(cursor_++);
+  switch (entry.type) {
+    case JsonTape::kNull:
+      return factory()->null_value();
+    case JsonTape::kTrue:
+      return factory()->true_value();
+    case JsonTape::kFalse:
+      return factory()->false_value();
+    case JsonTape::kSmi:
+      return handle(Smi::FromInt(static_cast<int>(entry.payload)), isolate());
+    case JsonTape::kNumber:
+      return factory()->NewNumber(tape_->number(entry.payload), pretenure_);
+    case JsonTape::kSourceString:
+    case JsonTape::kDecodedString:
+      return MaterializeString(entry);
+    case JsonTape::kObject:
+      return MaterializeObject(entry.length);
+    case JsonTape::kArray:
+      return MaterializeArray(entry.length);
+    case JsonTape::kIndexKey:
+      break;
+  }
+  UNREACHABLE();
+  return Handle<Object>::null();
+}
+
+
+Handle<String> JsonTapeMaterializer::MaterializeString(
+    const JsonTape::Entry& entry) {
+  if (entry.type == JsonTape::kSourceString && tape_->is_one_byte_source()) {
+    return factory()
+        ->NewStringFromOneByte(
+            tape_->OneByteSourceChars(entry.payload, entry.length), pretenure_)
+        .ToHandleChecked();
+  }
+  Vector<const uc16> chars =
+      entry.type == JsonTape::kSourceString
+          ? tape_->TwoByteSourceChars(entry.payload, entry.length)
+          : tape_->DecodedChars(entry.payload, entry.length);
+  // Produces a one-byte string if the characters allow it.
+  return factory()->NewStringFromTwoByte(chars, pretenure_).ToHandleChecked();
+}
+
+
+Handle<String> JsonTapeMaterializer::InternalizeKey(
+    const JsonTape::Entry& entry) {
+  if (entry.type == JsonTape::kSourceString && tape_->is_one_byte_source()) {
+    return factory()->InternalizeOneByteString(
+        tape_->OneByteSourceChars(entry.payload, entry.length));
+  }
+  Vector<const uc16> chars =
+      entry.type == JsonTape::kSourceString
+          ? tape_->TwoByteSourceChars(entry.payload, entry.length)
+          : tape_->DecodedChars(entry.payload, entry.length);
+  if (!entry.one_byte) return factory()->InternalizeTwoByteString(chars);
+  // Narrow the key so that the internalized string is a one-byte string.
+  ScopedVector<uint8_t> one_byte_chars(chars.length());
+  CopyChars(one_byte_chars.start(), chars.start(), chars.length());
+  return factory()->InternalizeOneByteString(
+      Vector<const uint8_t>(one_byte_chars.start(), chars.length()));
+}
+
+
+bool JsonTapeMaterializer::KeyEquals(String* key,
+                                     const JsonTape::Entry& entry) {
+  DisallowHeapAllocation no_gc;
+  if (entry.type == JsonTape::kSourceString && tape_->is_one_byte_source()) {
+    return key->IsOneByteEqualTo(
+        tape_->OneByteSourceChars(entry.payload, entry.length));
+  }
+  return key->IsTwoByteEqualTo(
+      entry.type == JsonTape::kSourceString
+          ? tape_->TwoByteSourceChars(entry.payload, entry.length)
+          : tape_->DecodedChars(entry.payload, entry.length));
+}
+
+
+// Materializes a JSON object. Properties are added by following map
+// transitions as long as possible, see JsonParser::ParseJsonObject.
+Handle<Object> JsonTapeMaterializer::MaterializeObject(int length) {
+  HandleScope scope(isolate());
+  Handle<JSObject> json_object =
+      factory()->NewJSObject(object_constructor_, pretenure_);
+  Handle<Map> map(json_object->map());
+  int descriptor = 0;
+  ZoneList<Handle<Object> > properties(Min(length, 8), zone());
+
+  bool transitioning = true;
+  bool committed = false;
+
+  for (int i = 0; i < length; i++) {
+    const JsonTape::Entry& key_entry = tape_->entry(cursor_++);
+    if (key_entry.type == JsonTape::kIndexKey) {
+      Handle<Object> value = MaterializeValue();
+      if (value.is_null()) return value;
+      JSObject::SetOwnElementIgnoreAttributes(json_object, key_entry.payload,
+                                              value, NONE)
+          .Assert();
+      continue;
+    }
+
+    Handle<String> key;
+    Handle<Map> target;
+    if (transitioning) {
+      // First check whether there is a single expected transition, which can
+      // be followed without internalizing the key.
+      Handle<String> expected = TransitionArray::ExpectedTransitionKey(map);
+      if (!expected.is_null() && KeyEquals(*expected, key_entry)) {
+        key = expected;
+        target = TransitionArray::ExpectedTransitionTarget(map);
+      } else {
+        key = InternalizeKey(key_entry);
+        target = TransitionArray::FindTransitionToField(map, key);
+        transitioning = !target.is_null();
+      }
+    } else {
+      key = InternalizeKey(key_entry);
+    }
+
+    Handle<Object> value = MaterializeValue();
+    if (value.is_null()) return value;
+
+    if (transitioning) {
+      PropertyDetails details =
+          target->instance_descriptors()->GetDetails(descriptor);
+      Representation expected_representation = details.representation();
+
+      if (value->FitsRepresentation(expected_representation)) {
+        if (expected_representation.IsHeapObject() &&
+            !target->instance_descriptors()
+                 ->GetFieldType(descriptor)
+                 ->NowContains(value)) {
+          Handle<FieldType> value_type(
+              value->OptimalType(isolate(), expected_representation));
+          Map::GeneralizeFieldType(target, descriptor, expected_representation,
+                                   value_type);
+        }
+        DCHECK(target->instance_descriptors()
+                   ->GetFieldType(descriptor)
+                   ->NowContains(value));
+        properties.Add(value, zone());
+        map = target;
+        descriptor++;
+        continue;
+      }
+      transitioning = false;
+    }
+
+    if (!committed) {
+      // Commit the intermediate state to the object once we stop
+      // transitioning.
+      CommitStateToJsonObject(json_object, map, &properties);
+      committed = true;
+    }
+    JSObject::DefinePropertyOrElementIgnoreAttributes(json_object, key, value)
+        .Check();
+  }
+
+  // If we transitioned until the very end, transition the map now.
+  if (!committed) CommitStateToJsonObject(json_object, map, &properties);
+  return scope.CloseAndEscape(json_object);
+}
+
+
+void JsonTapeMaterializer::CommitStateToJsonObject(
+    Handle<JSObject> json_object, Handle<Map> map,
+    ZoneList<Handle<Object> >* properties) {
+  JSObject::AllocateStorageForMap(json_object, map);
+  DCHECK(!json_object->map()->is_dictionary_map());
+
+  DisallowHeapAllocation no_gc;
+
+  int length = properties->length();
+  for (int i = 0; i < length; i++) {
+    Handle<Object> value = (*properties)[i];
+    json_object->WriteToField(i, *value);
+  }
+}
+
+
+Handle<Object> JsonTapeMaterializer::MaterializeArray(int length) {
+  HandleScope scope(isolate());
+  // Unlike JsonParser, the length is known up front.
+  Handle<FixedArray> elements = factory()->NewFixedArray(length, pretenure_);
+  for (int i = 0; i < length; i++) {
+    Handle<Object> element = MaterializeValue();
+    if (element.is_null()) return element;
+    elements->set(i, *element);
+  }
+  Handle<Object> json_array = factory()->NewJSArrayWithElements(
+      elements, FAST_ELEMENTS, Strength::WEAK, pretenure_);
+  return scope.CloseAndEscape(json_array);
+}
+
+
+BackgroundJsonParsingTask::BackgroundJsonParsingTask(JsonTape* tape,
+                                                     int stack_size)
+    : tape_(tape), stack_size_(stack_size) {}
+
+
+void BackgroundJsonParsingTask::Run() {
+  DisallowHeapAllocation no_allocation;
+  DisallowHandleAllocation no_handles;
+  DisallowHandleDereference no_deref;
+
+  uintptr_t stack_limit =
+      reinterpret_cast<uintptr_t>(&stack_limit) - stack_size_ * KB;
+  tape_->Parse(stack_limit);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,159 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_JSON_TAPE_H_
+#define V8_JSON_TAPE_H_
+
+#include "include/v8.h"
+#include "src/atomic-utils.h"
+#include "src/factory.h"
+#include "src/unicode-cache.h"
+#include "src/zone.h"
+
+namespace v8 {
+namespace internal {
+
+// A JSON text which has been tokenized and validated without touching the
+// heap, so that the expensive part of JSON.parse can run on a background
+// thread. Values are recorded in preorder: an array entry is followed by the
+// entries of its elements, an object entry by the entries of its keys and
+// values. Strings without escapes refer to the source, all other strings are
+// decoded into a side buffer. The JsonTapeMaterializer turns the tape into
+// heap objects on the main thread.
+//
+// Internal representation of v8::JSON::PreparedSource.
+class JsonTape {
+ public:
+  enum Type {
+    kNull,
+    kTrue,
+    kFalse,
+    kSmi,            // |payload| is the value.
+    kNumber,         // |payload| indexes number().
+    kSourceString,   // |payload| is the offset in the source.
+    kDecodedString,  // |payload| is the offset in the decoded characters.
+    kIndexKey,       // An object key that is an array index in |payload|.
+    kArray,          // Followed by |length| values.
+    kObject          // Followed by |length| key/value pairs.
+  };
+
+  struct Entry {
+    Type type;
+    // Whether all characters of a string fit in Latin1.
+    bool one_byte;
+    // The length of a string, array or object.
+    int length;
+    uint32_t payload;
+  };
+
+  enum State { kNotParsed, kParsed, kSyntaxError, kStackOverflow, kCancelled };
+
+  JsonTape(const uint8_t* one_byte_source, int length);
+  JsonTape(const uint16_t* two_byte_source, int length);
+
+  // Tokenizes and validates the source. Does not allocate on the heap and can
+  // be called from any thread, but only once.
+  void Parse(uintptr_t stack_limit);
+
+  // Can be called from any thread. Stops Parse() at the next check.
+  void Cancel() { cancelled_.SetValue(true); }
+  bool cancelled() { return cancelled_.Value(); }
+
+  State state() const { return state_; }
+  int length() const { return entries_.length(); }
+  const Entry& entry(int index) const { return entries_[index]; }
+  double number(int index) const { return numbers_[index]; }
+
+  bool is_one_byte_source() const { return one_byte_source_ != NULL; }
+  int source_length() const { return source_length_; }
+  Vector<const uint8_t> OneByteSourceChars(int start, int length) const {
+    DCHECK(is_one_byte_source());
+    return Vector<const uint8_t>(one_byte_source_ + start, length);
+  }
+  Vector<const uc16> TwoByteSourceChars(int start, int length) const {
+    DCHECK(!is_one_byte_source());
+    return Vector<const uc16>(two_byte_source_ + start, length);
+  }
+  Vector<const uc16> DecodedChars(int start, int length) const {
+    return decoded_chars_.ToConstVector().SubVector(start, start + length);
+  }
+
+  // Position and character of a syntax error. The character is
+  // JsonParser::kEndOfString if the source ended early.
+  int error_position() const { return error_position_; }
+  uc32 error_character() const { return error_character_; }
+
+ private:
+  template <typename Char>
+  friend class JsonTapeBuilder;
+
+  Zone zone_;
+  ZoneList<Entry> entries_;
+  ZoneList<double> numbers_;
+  ZoneList<uc16> decoded_chars_;
+  UnicodeCache unicode_cache_;
+
+  const uint8_t* one_byte_source_;   // Not owned.
+  const uint16_t* two_byte_source_;  // Not owned.
+  int source_length_;
+
+  State state_;
+  AtomicValue<bool> cancelled_;
+  int error_position_;
+  uc32 error_character_;
+
+  DISALLOW_COPY_AND_ASSIGN(JsonTape);
+};
+
+
+// Creates the heap objects described by a parsed JsonTape, following map
+// transitions for object properties the way JsonParser does.
+class JsonTapeMaterializer BASE_EMBEDDED {
+ public:
+  MUST_USE_RESULT static MaybeHandle<Object> Materialize(Isolate* isolate,
+                                                         const JsonTape* tape);
+
+ private:
+  JsonTapeMaterializer(Isolate* isolate, const JsonTape* tape);
+
+  Handle<Object> MaterializeValue();
+  Handle<Object> MaterializeObject(int length);
+  Handle<Object> MaterializeArray(int length);
+  Handle<String> MaterializeString(const JsonTape::Entry& entry);
+  Handle<String> InternalizeKey(const JsonTape::Entry& entry);
+  bool KeyEquals(String* key, const JsonTape::Entry& entry);
+
+  void CommitStateToJsonObject(Handle<JSObject> json_object, Handle<Map> map,
+                               ZoneList<Handle<Object> >* properties);
+
+  Isolate* isolate() { return isolate_; }
+  Factory* factory() { return factory_; }
+  Zone* zone() { return &zone_; }
+
+  static const int kPretenureTreshold = 100 * 1024;
+
+  Isolate* isolate_;
+  Factory* factory_;
+  const JsonTape* tape_;
+  Zone zone_;
+  Handle<JSFunction> object_constructor_;
+  PretenureFlag pretenure_;
+  int cursor_;
+};
+
+
+class BackgroundJsonParsingTask : public JSON::ParseTask {
+ public:
+  BackgroundJsonParsingTask(JsonTape* tape, int stack_size);
+
+  virtual void Run();
+
+ private:
+  JsonTape* tape_;  // Not owned.
+  int stack_size_;
+};
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_JSON_TAPE_H_
@@ -814,6 +814,13 @@ void JSRegExp::JSRegExpVerify() {
       CHECK(arr->get(JSRegExp::kIrregexpMaxRegisterCountIndex)->IsSmi());
       break;
     }
+    case JSRegExp::LINEAR: {
+      FixedArray* arr = FixedArray::cast(data());
+      CHECK(arr->get(JSRegExp::kIrregexpLatin1CodeIndex)->IsByteArray());
+      CHECK(arr->get(JSRegExp::kIrregexpUC16CodeIndex)->IsByteArray());
+      CHECK(arr->get(JSRegExp::kIrregexpCaptureCountIndex)->IsSmi());
+      break;
+    }
     default:
       CHECK_EQ(JSRegExp::NOT_COMPILED, TypeTag());
       CHECK(data()->IsUndefined());
@@ -908,6 +915,16 @@ void SloppyBlockWithEvalContextExtension::
 }
 
 
+void PromiseReactionJobInfo::PromiseReactionJobInfoVerify() {
+  CHECK(IsPromiseReactionJobInfo());
+  VerifyObjectField(kValueOffset);
+  VerifyObjectField(kTasksOffset);
+  VerifyObjectField(kContextOffset);
+  CHECK(tasks()->IsJSArray());
+  CHECK(context()->IsNativeContext());
+}
+
+
 void AccessorInfo::AccessorInfoVerify() {
   CHECK(IsAccessorInfo());
   VerifyPointer(name());
@@ -5359,6 +5359,10 @@ ACCESSORS(SloppyBlockWithEvalContextExtension, scope_info, ScopeInfo,
 ACCESSORS(SloppyBlockWithEvalContextExtension, extension, JSObject,
           kExtensionOffset)
 
+ACCESSORS(PromiseReactionJobInfo, value, Object, kValueOffset)
+ACCESSORS(PromiseReactionJobInfo, tasks, JSArray, kTasksOffset)
+ACCESSORS(PromiseReactionJobInfo, context, Context, kContextOffset)
+
 ACCESSORS(AccessorPair, getter, Object, kGetterOffset)
 ACCESSORS(AccessorPair, setter, Object, kSetterOffset)
 
@@ -5437,6 +5441,7 @@ ACCESSORS(Script, shared_function_infos, Object, kSharedFunctionInfosOffset)
 SMI_ACCESSORS(Script, flags, kFlagsOffset)
 ACCESSORS(Script, source_url, Object, kSourceUrlOffset)
 ACCESSORS(Script, source_mapping_url, Object, kSourceMappingUrlOffset)
+ACCESSORS(Script, preparse_data, Object, kPreparseDataOffset)
 
 Script::CompilationType Script::compilation_type() {
   return BooleanBit::get(flags(), kCompilationTypeBit) ?
@@ -6485,6 +6490,7 @@ int JSRegExp::CaptureCount() {
     case ATOM:
       return 0;
     case IRREGEXP:
+    case LINEAR:
       return Smi::cast(DataAt(kIrregexpCaptureCountIndex))->value();
     default:
       UNREACHABLE();
@@ -1002,6 +1002,16 @@ void SloppyBlockWithEvalContextExtension::
 }
 
 
+void PromiseReactionJobInfo::PromiseReactionJobInfoPrint(
+    std::ostream& os) {  // NOLINT
+  HeapObject::PrintHeader(os, "PromiseReactionJobInfo");
+  os << "\n - value: " << Brief(value());
+  os << "\n - tasks: " << Brief(tasks());
+  os << "\n - context: " << Brief(context());
+  os << "\n";
+}
+
+
 void AccessorPair::AccessorPairPrint(std::ostream& os) {  // NOLINT
   HeapObject::PrintHeader(os, "AccessorPair");
   os << "\n - getter: " << Brief(getter());
@@ -1127,6 +1137,7 @@ void Script::ScriptPrint(std::ostream& os) {  // NOLINT
   os << "\n - eval from instructions offset: "
      << eval_from_instructions_offset();
   os << "\n - shared function infos: " << Brief(shared_function_infos());
+  os << "\n - preparse data: " << Brief(preparse_data());
   os << "\n";
 }
 
@@ -11955,6 +11955,13 @@ bool String::SlowEquals(Handle<String> one, Handle<String> two) {
   // before we try to flatten the strings.
   if (one->Get(0) != two->Get(0)) return false;
 
+  // Compare ropes leaf by leaf instead of copying them into flat strings.
+  if (!one->IsFlat() || !two->IsFlat()) {
+    DisallowHeapAllocation no_gc;
+    StringComparator comparator;
+    return comparator.Equals(*one, *two);
+  }
+
   one = String::Flatten(one);
   two = String::Flatten(two);
 
@@ -12619,6 +12626,14 @@ static void GetMinInobjectSlack(Map* map, void* data) {
 }
 
 
+static void GetMaxOutOfObjectFields(Map* map, void* data) {
+  int fields = map->NumberOfFields() - map->GetInObjectProperties();
+  if (*reinterpret_cast<int*>(data) < fields) {
+    *reinterpret_cast<int*>(data) = fields;
+  }
+}
+
+
 static void ShrinkInstanceSize(Map* map, void* data) {
   int slack = *reinterpret_cast<int*>(data);
   map->SetInObjectProperties(map->GetInObjectProperties() - slack);
@@ -12640,6 +12655,26 @@ void Map::CompleteInobjectSlackTracking() {
   if (slack != 0) {
     // Resize the initial map and all maps in its transition tree.
     TransitionArray::TraverseTransitionTree(this, &ShrinkInstanceSize, &slack);
+    return;
+  }
+
+  // Objects that outgrew the in-object space have their remaining fields in
+  // a property backing store. Record how many fields they needed, so that
+  // initial maps created for the same function later are large enough.
+  int out_of_object_fields = 0;
+  TransitionArray::TraverseTransitionTree(this, &GetMaxOutOfObjectFields,
+                                          &out_of_object_fields);
+  Object* constructor = GetConstructor();
+  if (out_of_object_fields > 0 && constructor->IsJSFunction()) {
+    SharedFunctionInfo* shared = JSFunction::cast(constructor)->shared();
+    int expected = shared->expected_nof_properties();
+    int predicted = Min(expected + out_of_object_fields,
+                        JSObject::kMaxInObjectPropertiesPrediction);
+    if (predicted > expected) {
+      shared->set_expected_nof_properties(predicted);
+      GetIsolate()->counters()->inobject_properties_predicted()->Increment(
+          predicted - expected);
+    }
   }
 }
 
@@ -17236,37 +17271,33 @@ Handle<Derived> HashTable<Derived, Shape, Key>::New(
 template <typename Derived, typename Shape>
 int NameDictionaryBase<Derived, Shape>::FindEntry(Handle<Name> key) {
   if (!key->IsUniqueName()) {
-    return DerivedDictionary::FindEntry(key);
+    // Dictionary keys are always unique names, so a non-internalized string
+    // can only be present if its internalized copy exists.
+    Handle<String> internalized;
+    if (!StringTable::LookupStringIfExists(this->GetIsolate(),
+                                           Handle<String>::cast(key))
+             .ToHandle(&internalized)) {
+      return Derived::kNotFound;
+    }
+    key = internalized;
   }
 
-  // Optimized for unique names. Knowledge of the key type allows:
-  // 1. Move the check if the key is unique out of the loop.
-  // 2. Avoid comparing hash codes in unique-to-unique comparison.
-  // 3. Detect a case when a dictionary key is not unique but the key is.
-  //    In case of positive result the dictionary key may be replaced by the
-  //    internalized string with minimal performance penalty. It gives a chance
-  //    to perform further lookups in code stubs (and significant performance
-  //    boost a certain style of code).
+  // Optimized for unique names. Since both the key and the dictionary keys
+  // are unique, entries are compared by identity alone and probing never
+  // has to load a colliding key to look at its map, hash or contents.
 
   // EnsureCapacity will guarantee the hash table is never full.
+  Object* undefined = this->GetHeap()->undefined_value();
+  Name* raw_key = *key;
   uint32_t capacity = this->Capacity();
-  uint32_t entry = Derived::FirstProbe(key->Hash(), capacity);
+  uint32_t entry = Derived::FirstProbe(raw_key->Hash(), capacity);
   uint32_t count = 1;
 
   while (true) {
-    int index = Derived::EntryToIndex(entry);
-    Object* element = this->get(index);
-    if (element->IsUndefined()) break;  // Empty entry.
-    if (*key == element) return entry;
-    if (!element->IsUniqueName() &&
-        !element->IsTheHole() &&
-        Name::cast(element)->Equals(*key)) {
-      // Replace a key that is a non-internalized string by the equivalent
-      // internalized string for faster further lookups.
-      this->set(index, *key);
-      return entry;
-    }
-    DCHECK(element->IsTheHole() || !Name::cast(element)->Equals(*key));
+    Object* element = this->KeyAt(entry);
+    if (element == raw_key) return entry;
+    if (element == undefined) break;  // Empty entry.
+    DCHECK(element->IsTheHole() || element->IsUniqueName());
     entry = Derived::NextProbe(entry, count++, capacity);
   }
   return Derived::kNotFound;
@@ -18005,8 +18036,8 @@ MaybeHandle<String> StringTable::LookupTwoCharsStringIfExists(
 }
 
 
-void StringTable::EnsureCapacityForDeserialization(Isolate* isolate,
-                                                   int expected) {
+void StringTable::EnsureCapacityForBulkInsert(Isolate* isolate,
+                                              int expected) {
   Handle<StringTable> table = isolate->factory()->string_table();
   // We need a key instance for the virtual hash function.
   InternalizedStringKey dummy_key(Handle<String>::null());
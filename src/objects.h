@@ -404,6 +404,7 @@ const int kStubMinorKeyBits = kSmiValueSize - kStubMajorKeyBits - 1;
   V(BOX_TYPE)                                                   \
   V(PROTOTYPE_INFO_TYPE)                                        \
   V(SLOPPY_BLOCK_WITH_EVAL_CONTEXT_EXTENSION_TYPE)              \
+  V(PROMISE_REACTION_JOB_INFO_TYPE)                             \
                                                                 \
   V(FIXED_ARRAY_TYPE)                                           \
   V(FIXED_DOUBLE_ARRAY_TYPE)                                    \
@@ -522,7 +523,9 @@ const int kStubMinorKeyBits = kSmiValueSize - kStubMajorKeyBits - 1;
   V(PROTOTYPE_INFO, PrototypeInfo, prototype_info)                           \
   V(SLOPPY_BLOCK_WITH_EVAL_CONTEXT_EXTENSION,                                \
     SloppyBlockWithEvalContextExtension,                                     \
-    sloppy_block_with_eval_context_extension)
+    sloppy_block_with_eval_context_extension)                                \
+  V(PROMISE_REACTION_JOB_INFO, PromiseReactionJobInfo,                       \
+    promise_reaction_job_info)
 
 // We use the full 8 bits of the instance_type field to encode heap object
 // instance types.  The high-order bit (bit 7) is set if the object is not a
@@ -700,6 +703,7 @@ enum InstanceType {
   PROPERTY_CELL_TYPE,
   PROTOTYPE_INFO_TYPE,
   SLOPPY_BLOCK_WITH_EVAL_CONTEXT_EXTENSION_TYPE,
+  PROMISE_REACTION_JOB_INFO_TYPE,
 
   // All the following types are subtypes of JSReceiver, which corresponds to
   // objects in the JS sense. The first and the last type in this range are
@@ -2464,6 +2468,8 @@ class JSObject: public JSReceiver {
   static const int kInitialGlobalObjectUnusedPropertiesCount = 4;
 
   static const int kMaxInstanceSize = 255 * kPointerSize;
+  // Upper bound for the in-object properties predicted by slack tracking.
+  static const int kMaxInObjectPropertiesPrediction = 64;
   // When extending the backing storage for property values, we increase
   // its size by more than the 1 entry necessary, so sequentially adding fields
   // to the same object requires fewer allocations and copies.
@@ -3408,7 +3414,9 @@ class StringTable: public HashTable<StringTable,
       uint16_t c1,
       uint16_t c2);
 
-  static void EnsureCapacityForDeserialization(Isolate* isolate, int expected);
+  // Grows the string table so that |expected| strings can be added to it
+  // without further reallocation. Used before inserting many strings at once.
+  static void EnsureCapacityForBulkInsert(Isolate* isolate, int expected);
 
   DECLARE_CAST(StringTable)
 
@@ -3572,7 +3580,7 @@ class NameDictionaryBase : public Dictionary<Derived, Shape, Handle<Name> > {
 
  public:
   // Find entry for key, otherwise return kNotFound. Optimized version of
-  // HashTable::FindEntry.
+  // HashTable::FindEntry that relies on all keys being unique names.
   int FindEntry(Handle<Name> key);
 };
 
@@ -5641,9 +5649,12 @@ class Map: public HeapObject {
   //   of every map. Existing objects will resize automatically (they are
   //   filled with one_pointer_filler_map). All further allocations will
   //   use the adjusted instance size.
-  // - SharedFunctionInfo's expected_nof_properties left unmodified since
+  // - SharedFunctionInfo's expected_nof_properties is never lowered, since
   //   allocations made using different closures could actually create different
-  //   kind of objects (see prototype inheritance pattern).
+  //   kind of objects (see prototype inheritance pattern). If there was no
+  //   slack because objects grew beyond their in-object space, it is raised
+  //   by the number of out-of-object fields so that initial maps created
+  //   later for this function fit all fields in-object.
   //
   //  Important: inobject slack tracking is not attempted during the snapshot
   //  creation.
@@ -6360,6 +6371,34 @@ class SloppyBlockWithEvalContextExtension : public Struct {
 };
 
 
+// A microtask that runs the reactions of a settled promise. Enqueued instead
+// of a closure so that settling a promise does not allocate a function and
+// its context.
+class PromiseReactionJobInfo : public Struct {
+ public:
+  // [value]: The value the promise was resolved or rejected with.
+  DECL_ACCESSORS(value, Object)
+  // [tasks]: Pairs of reaction handlers and the deferreds they resolve.
+  DECL_ACCESSORS(tasks, JSArray)
+  // [context]: The native context the reactions run in.
+  DECL_ACCESSORS(context, Context)
+
+  DECLARE_CAST(PromiseReactionJobInfo)
+
+  // Dispatched behavior.
+  DECLARE_PRINTER(PromiseReactionJobInfo)
+  DECLARE_VERIFIER(PromiseReactionJobInfo)
+
+  static const int kValueOffset = HeapObject::kHeaderSize;
+  static const int kTasksOffset = kValueOffset + kPointerSize;
+  static const int kContextOffset = kTasksOffset + kPointerSize;
+  static const int kSize = kContextOffset + kPointerSize;
+
+ private:
+  DISALLOW_IMPLICIT_CONSTRUCTORS(PromiseReactionJobInfo);
+};
+
+
 // Script describes a script which has been added to the VM.
 class Script: public Struct {
  public:
@@ -6431,6 +6470,11 @@ class Script: public Struct {
   // [source_url]: sourceMappingURL magic comment
   DECL_ACCESSORS(source_mapping_url, Object)
 
+  // [preparse_data]: ObjectHashTable mapping the start positions of inner
+  // function declarations to the scope data recorded for them by the parser,
+  // or undefined.
+  DECL_ACCESSORS(preparse_data, Object)
+
   // [compilation_type]: how the the script was compiled. Encoded in the
   // 'flags' field.
   inline CompilationType compilation_type();
@@ -6510,7 +6554,8 @@ class Script: public Struct {
   static const int kFlagsOffset = kSharedFunctionInfosOffset + kPointerSize;
   static const int kSourceUrlOffset = kFlagsOffset + kPointerSize;
   static const int kSourceMappingUrlOffset = kSourceUrlOffset + kPointerSize;
-  static const int kSize = kSourceMappingUrlOffset + kPointerSize;
+  static const int kPreparseDataOffset = kSourceMappingUrlOffset + kPointerSize;
+  static const int kSize = kPreparseDataOffset + kPointerSize;
 
  private:
   int GetLineNumberWithArray(int code_pos);
@@ -7863,7 +7908,9 @@ class JSRegExp: public JSObject {
   // ATOM: A simple string to match against using an indexOf operation.
   // IRREGEXP: Compiled with Irregexp.
   // IRREGEXP_NATIVE: Compiled to native code with Irregexp.
-  enum Type { NOT_COMPILED, ATOM, IRREGEXP };
+  // LINEAR: Compiled to a program for the NFA engine in regexp-nfa.h. The
+  // data is laid out as for IRREGEXP, with the program in both code slots.
+  enum Type { NOT_COMPILED, ATOM, IRREGEXP, LINEAR };
   enum Flag {
     kNone = 0,
     kGlobal = 1 << 0,
@@ -7871,6 +7918,9 @@ class JSRegExp: public JSObject {
     kMultiline = 1 << 2,
     kSticky = 1 << 3,
     kUnicode = 1 << 4,
+    // Not a JavaScript flag. Requests the linear-time engine, see
+    // v8::RegExp::kLinear.
+    kLinear = 1 << 5,
   };
   typedef base::Flags<Flag> Flags;
 
@@ -9468,6 +9518,40 @@ class ConsStringIterator {
 };
 
 
+// Yields the flat content of the leaves of a cons string from left to right,
+// or that of the string itself if it is not a cons string, so that the
+// characters can be processed a segment at a time without flattening.
+// Heap allocation must be disallowed while the iterator is in use.
+class StringSegmentIterator {
+ public:
+  inline explicit StringSegmentIterator(String* string) {
+    if (string->IsConsString()) {
+      iter_.Reset(ConsString::cast(string));
+      int offset;
+      next_ = iter_.Next(&offset);
+      DCHECK_EQ(0, offset);
+    } else {
+      iter_.Reset(NULL);
+      next_ = string;
+    }
+  }
+  inline bool done() { return next_ == NULL; }
+  inline String::FlatContent Next() {
+    DCHECK(!done());
+    String* segment = next_;
+    int offset;
+    next_ = iter_.Next(&offset);
+    DCHECK_EQ(0, offset);
+    return segment->GetFlatContent();
+  }
+
+ private:
+  ConsStringIterator iter_;
+  String* next_;
+  DISALLOW_COPY_AND_ASSIGN(StringSegmentIterator);
+};
+
+
 class StringCharacterStream {
  public:
   inline StringCharacterStream(String* string,
@@ -16,6 +16,8 @@
 #include "src/char-predicates-inl.h"
 #include "src/codegen.h"
 #include "src/compiler.h"
+#include "src/debug/debug.h"
+#include "src/debug/liveedit.h"
 #include "src/messages.h"
 #include "src/parsing/parameter-initializer-rewriter.h"
 #include "src/parsing/parser-base.h"
@@ -753,6 +755,7 @@ Parser::Parser(ParseInfo* info)
       target_stack_(NULL),
       compile_options_(info->compile_options()),
       cached_parse_data_(NULL),
+      inner_function_recorder_(NULL),
       total_preparse_skipped_(0),
       pre_parse_timer_(NULL),
       parsing_on_main_thread_(true) {
@@ -825,6 +828,11 @@ FunctionLiteral* Parser::ParseProgram(Isolate* isolate, ParseInfo* info) {
         Handle<ExternalTwoByteString>::cast(source), 0, source->length());
     scanner_.Initialize(&stream);
     result = DoParseProgram(info);
+  } else if (source->IsSeqOneByteString() ||
+             source->IsExternalOneByteString()) {
+    OneByteStringUtf16CharacterStream stream(source, 0, source->length());
+    scanner_.Initialize(&stream);
+    result = DoParseProgram(info);
   } else {
     GenericStringUtf16CharacterStream stream(source, 0, source->length());
     scanner_.Initialize(&stream);
@@ -969,6 +977,7 @@ FunctionLiteral* Parser::ParseLazy(Isolate* isolate, ParseInfo* info) {
     timer.Start();
   }
   Handle<SharedFunctionInfo> shared_info = info->shared_info();
+  SetInnerFunctionData(isolate, info);
 
   // Initialize parser state.
   source = String::Flatten(source);
@@ -979,12 +988,21 @@ FunctionLiteral* Parser::ParseLazy(Isolate* isolate, ParseInfo* info) {
         shared_info->start_position(),
         shared_info->end_position());
     result = ParseLazy(isolate, info, &stream);
+  } else if (source->IsSeqOneByteString() ||
+             source->IsExternalOneByteString()) {
+    OneByteStringUtf16CharacterStream stream(source,
+                                             shared_info->start_position(),
+                                             shared_info->end_position());
+    result = ParseLazy(isolate, info, &stream);
   } else {
     GenericStringUtf16CharacterStream stream(source,
                                              shared_info->start_position(),
                                              shared_info->end_position());
     result = ParseLazy(isolate, info, &stream);
   }
+  if (result != NULL && inner_function_recorder_ != NULL) {
+    StoreInnerFunctionData(isolate, info->script());
+  }
 
   if (FLAG_trace_parse && result != NULL) {
     double ms = timer.Elapsed().InMillisecondsF();
@@ -4250,6 +4268,7 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
     CheckArityRestrictions(arity, kind, formals.has_rest, start_position,
                            formals_end_position, CHECK_OK);
     Expect(Token::LBRACE, CHECK_OK);
+    int function_block_pos = position();
 
     // Don't include the rest parameter into the function's formal parameter
     // count (esp. the SharedFunctionInfo::internal_formal_parameter_count,
@@ -4321,6 +4340,14 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
         should_be_used_once_hint = true;
       }
     }
+    bool can_skip_inner_function = CanSkipInnerFunction(
+        function_type, kind, eager_compile_hint, formals);
+    if (can_skip_inner_function && !is_lazily_parsed) {
+      is_lazily_parsed = SkipInnerFunctionBody(
+          &materialized_literal_count, &expected_property_count, CHECK_OK);
+      // Only functions which were parsed in full are recorded.
+      can_skip_inner_function = !is_lazily_parsed;
+    }
     if (!is_lazily_parsed) {
       // Determine whether the function body can be discarded after parsing.
       // The preconditions are:
@@ -4395,6 +4422,10 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
         allow_harmony_destructuring_bind()) {
       CheckConflictingVarDeclarations(scope, CHECK_OK);
     }
+    if (can_skip_inner_function) {
+      LogInnerFunction(scope, function_block_pos, materialized_literal_count,
+                       expected_property_count);
+    }
 
     if (body) {
       // If body can be inspected, rewrite queued destructuring assignments
@@ -4501,6 +4532,166 @@ void Parser::SkipLazyFunctionBody(int* materialized_literal_count,
 }
 
 
+bool Parser::CanSkipInnerFunction(FunctionLiteral::FunctionType function_type,
+                                  FunctionKind kind,
+                                  FunctionLiteral::EagerCompileHint hint,
+                                  const ParserFormalParameters& formals) {
+  if (inner_function_recorder_ == NULL) return false;
+  // Only plain function declarations are guaranteed to be compiled lazily, so
+  // only their bodies can be dropped. Expressions may turn out to be invoked
+  // immediately, which makes the compiler ask for their body.
+  if (function_type != FunctionLiteral::kDeclaration ||
+      kind != kNormalFunction || hint == FunctionLiteral::kShouldEagerCompile ||
+      !formals.is_simple || allow_natives() || extension_ != NULL) {
+    return false;
+  }
+  // Never skip the function that is being compiled itself, and leave asm.js
+  // modules alone since they are validated as a whole.
+  Scope* outer_declaration_scope = scope_->outer_scope()->DeclarationScope();
+  return outer_declaration_scope != original_scope_->DeclarationScope() &&
+         !outer_declaration_scope->asm_module();
+}
+
+
+bool Parser::SkipInnerFunctionBody(int* materialized_literal_count,
+                                   int* expected_property_count, bool* ok) {
+  if (inner_function_data_.is_null()) return false;
+  Isolate* isolate = inner_function_data_->GetIsolate();
+  int function_block_pos = position();
+  int end_pos;
+  {
+    DisallowHeapAllocation no_gc;
+    Object* data = inner_function_data_->Lookup(
+        handle(Smi::FromInt(function_block_pos), isolate));
+    if (!data->IsByteArray()) return false;
+    ByteArray* bytes = ByteArray::cast(data);
+    InnerFunctionEntry entry(Vector<const unsigned>(
+        reinterpret_cast<const unsigned*>(bytes->GetDataStartAddress()),
+        bytes->length() / static_cast<int>(sizeof(unsigned))));
+    if (!entry.is_valid() || entry.end_pos() <= function_block_pos) {
+      return false;
+    }
+    Vector<const unsigned> free_variables = entry.free_variables();
+    ZoneList<const AstRawString*> names(entry.free_variable_count(), zone());
+    ZoneList<bool> assigned(entry.free_variable_count(), zone());
+    int index = 0;
+    for (int i = 0; i < entry.free_variable_count(); i++) {
+      if (index + 2 > free_variables.length()) return false;
+      unsigned flags = free_variables[index++];
+      int byte_length = free_variables[index++];
+      int words = (byte_length + sizeof(unsigned) - 1) / sizeof(unsigned);
+      if (index + words > free_variables.length()) return false;
+      const byte* name_bytes =
+          reinterpret_cast<const byte*>(&free_variables[index]);
+      index += words;
+      if (flags & InnerFunctionRecorder::kIsOneByteFlag) {
+        names.Add(ast_value_factory()->GetOneByteString(
+                      Vector<const uint8_t>(name_bytes, byte_length)),
+                  zone());
+      } else {
+        names.Add(ast_value_factory()->GetTwoByteString(Vector<const uint16_t>(
+                      reinterpret_cast<const uint16_t*>(name_bytes),
+                      byte_length / sizeof(uint16_t))),
+                  zone());
+      }
+      assigned.Add((flags & InnerFunctionRecorder::kIsAssignedFlag) != 0,
+                   zone());
+    }
+    // Recreate the references to outer variables, so that scope analysis of
+    // the enclosing function allocates them as if the body had been parsed.
+    for (int i = 0; i < names.length(); i++) {
+      VariableProxy* proxy = scope_->NewUnresolved(
+          factory(), names[i], Variable::NORMAL, function_block_pos);
+      if (assigned[i]) proxy->set_is_assigned();
+    }
+    end_pos = entry.end_pos();
+    *materialized_literal_count = entry.literal_count();
+    *expected_property_count = entry.property_count();
+    SetLanguageMode(scope_, entry.language_mode());
+    if (entry.uses_super_property()) scope_->RecordSuperPropertyUsage();
+  }
+  scanner()->SeekForward(end_pos - 1);
+  scope_->set_end_position(end_pos);
+  Expect(Token::RBRACE, ok);
+  if (*ok) total_preparse_skipped_ += end_pos - function_block_pos;
+  return true;
+}
+
+
+void Parser::LogInnerFunction(Scope* scope, int function_block_pos,
+                              int materialized_literal_count,
+                              int expected_property_count) {
+  DCHECK_NOT_NULL(inner_function_recorder_);
+  ZoneList<VariableProxy*> proxies(4, zone());
+  if (!scope->CollectFreeVariables(scope, &proxies)) return;
+
+  // Merge the references to each variable into a single entry.
+  HashMap free_variables(HashMap::PointersMatch);
+  ZoneList<const AstRawString*> names(proxies.length(), zone());
+  ZoneList<bool> assigned(proxies.length(), zone());
+  for (int i = 0; i < proxies.length(); i++) {
+    const AstRawString* name = proxies[i]->raw_name();
+    HashMap::Entry* entry = free_variables.LookupOrInsert(
+        const_cast<AstRawString*>(name), name->hash());
+    if (entry->value == NULL) {
+      entry->value = reinterpret_cast<void*>(names.length() + 1);
+      names.Add(name, zone());
+      assigned.Add(false, zone());
+    }
+    int index = static_cast<int>(reinterpret_cast<intptr_t>(entry->value)) - 1;
+    if (proxies[i]->is_assigned()) assigned[index] = true;
+  }
+
+  inner_function_recorder_->LogFunction(
+      function_block_pos, scope->end_position(), materialized_literal_count,
+      expected_property_count, scope->language_mode(),
+      scope->uses_super_property(), names.length());
+  for (int i = 0; i < names.length(); i++) {
+    inner_function_recorder_->LogFreeVariable(
+        names[i]->is_one_byte(),
+        Vector<const byte>(names[i]->raw_data(), names[i]->byte_length()),
+        assigned[i]);
+  }
+}
+
+
+void Parser::SetInnerFunctionData(Isolate* isolate, ParseInfo* info) {
+  if (!FLAG_preparse_inner_functions || !FLAG_lazy) return;
+  // The debugger and live edit compile inner functions eagerly, which needs
+  // their bodies.
+  if (isolate->debug()->is_active() ||
+      LiveEditFunctionTracker::IsActive(isolate)) {
+    return;
+  }
+  Object* data = info->script()->preparse_data();
+  if (data->IsObjectHashTable()) {
+    inner_function_data_ = handle(ObjectHashTable::cast(data), isolate);
+  }
+  inner_function_recorder_ = new InnerFunctionRecorder();
+}
+
+
+void Parser::StoreInnerFunctionData(Isolate* isolate, Handle<Script> script) {
+  int count = inner_function_recorder_->function_count();
+  if (count == 0) return;
+  Handle<Object> data(script->preparse_data(), isolate);
+  Handle<ObjectHashTable> table =
+      data->IsObjectHashTable() ? Handle<ObjectHashTable>::cast(data)
+                                : ObjectHashTable::New(isolate, count);
+  for (int i = 0; i < count; i++) {
+    Handle<Smi> key(Smi::FromInt(inner_function_recorder_->start_position(i)),
+                    isolate);
+    if (!table->Lookup(key)->IsTheHole()) continue;
+    Vector<const unsigned> entry = inner_function_recorder_->GetEntry(i);
+    int length = entry.length() * static_cast<int>(sizeof(unsigned));
+    Handle<ByteArray> bytes = isolate->factory()->NewByteArray(length, TENURED);
+    MemCopy(bytes->GetDataStartAddress(), entry.start(), length);
+    table = ObjectHashTable::Put(table, key, bytes);
+  }
+  script->set_preparse_data(*table);
+}
+
+
 Statement* Parser::BuildAssertIsCoercible(Variable* var) {
   // if (var === null || var === undefined)
   //     throw /* type error kNonCoercible) */;
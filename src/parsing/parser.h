@@ -245,6 +245,44 @@ class FunctionEntry BASE_EMBEDDED {
 };
 
 
+// View of an entry recorded by InnerFunctionRecorder.
+class InnerFunctionEntry BASE_EMBEDDED {
+ public:
+  enum {
+    kEndPositionIndex,
+    kLiteralCountIndex,
+    kPropertyCountIndex,
+    kLanguageModeIndex,
+    kUsesSuperPropertyIndex,
+    kFreeVariableCountIndex,
+    kSize
+  };
+
+  explicit InnerFunctionEntry(Vector<const unsigned> backing)
+      : backing_(backing) {}
+
+  int end_pos() { return backing_[kEndPositionIndex]; }
+  int literal_count() { return backing_[kLiteralCountIndex]; }
+  int property_count() { return backing_[kPropertyCountIndex]; }
+  LanguageMode language_mode() {
+    DCHECK(is_valid_language_mode(backing_[kLanguageModeIndex]));
+    return static_cast<LanguageMode>(backing_[kLanguageModeIndex]);
+  }
+  bool uses_super_property() { return backing_[kUsesSuperPropertyIndex]; }
+  int free_variable_count() { return backing_[kFreeVariableCountIndex]; }
+
+  // The encoded free variables following the fixed fields.
+  Vector<const unsigned> free_variables() {
+    return backing_.SubVector(kSize, backing_.length());
+  }
+
+  bool is_valid() { return backing_.length() >= kSize; }
+
+ private:
+  Vector<const unsigned> backing_;
+};
+
+
 // Wrapper around ScriptData to provide parser-specific functionality.
 class ParseData {
  public:
@@ -688,6 +726,8 @@ class Parser : public ParserBase<ParserTraits> {
     reusable_preparser_ = NULL;
     delete cached_parse_data_;
     cached_parse_data_ = NULL;
+    delete inner_function_recorder_;
+    inner_function_recorder_ = NULL;
   }
 
   // Parses the source code represented by the compilation info and sets its
@@ -1004,6 +1044,25 @@ class Parser : public ParserBase<ParserTraits> {
   PreParser::PreParseResult ParseLazyFunctionBodyWithPreParser(
       SingletonLogger* logger, Scanner::BookmarkScope* bookmark = nullptr);
 
+  // Inner function declarations of a lazily compiled function are normally
+  // parsed in full, only to find out which outer variables they reference.
+  // With --preparse-inner-functions this information is recorded per script
+  // (see InnerFunctionRecorder) and reused when the enclosing function is
+  // parsed again.
+  bool CanSkipInnerFunction(FunctionLiteral::FunctionType function_type,
+                            FunctionKind kind,
+                            FunctionLiteral::EagerCompileHint hint,
+                            const ParserFormalParameters& formals);
+  // Skips the body of an inner function using recorded data if there is an
+  // entry for it. Consumes the ending } and returns true on success.
+  bool SkipInnerFunctionBody(int* materialized_literal_count,
+                             int* expected_property_count, bool* ok);
+  void LogInnerFunction(Scope* scope, int function_block_pos,
+                        int materialized_literal_count,
+                        int expected_property_count);
+  void SetInnerFunctionData(Isolate* isolate, ParseInfo* info);
+  void StoreInnerFunctionData(Isolate* isolate, Handle<Script> script);
+
   Block* BuildParameterInitializationBlock(
       const ParserFormalParameters& parameters, bool* ok);
 
@@ -1049,6 +1108,8 @@ class Parser : public ParserBase<ParserTraits> {
   Target* target_stack_;  // for break, continue statements
   ScriptCompiler::CompileOptions compile_options_;
   ParseData* cached_parse_data_;
+  Handle<ObjectHashTable> inner_function_data_;
+  InnerFunctionRecorder* inner_function_recorder_;
 
   PendingCompilationErrorHandler pending_error_handler_;
 
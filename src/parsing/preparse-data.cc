@@ -76,5 +76,52 @@ ScriptData* CompleteParserRecorder::GetScriptData() {
 }
 
 
+void InnerFunctionRecorder::LogFunction(int start, int end, int literals,
+                                        int properties,
+                                        LanguageMode language_mode,
+                                        bool uses_super_property,
+                                        int free_variable_count) {
+  start_positions_.Add(start);
+  entry_offsets_.Add(store_.length());
+  STATIC_ASSERT(InnerFunctionEntry::kEndPositionIndex == 0);
+  store_.Add(end);
+  STATIC_ASSERT(InnerFunctionEntry::kLiteralCountIndex == 1);
+  store_.Add(literals);
+  STATIC_ASSERT(InnerFunctionEntry::kPropertyCountIndex == 2);
+  store_.Add(properties);
+  STATIC_ASSERT(InnerFunctionEntry::kLanguageModeIndex == 3);
+  store_.Add(language_mode);
+  STATIC_ASSERT(InnerFunctionEntry::kUsesSuperPropertyIndex == 4);
+  store_.Add(uses_super_property);
+  STATIC_ASSERT(InnerFunctionEntry::kFreeVariableCountIndex == 5);
+  store_.Add(free_variable_count);
+  STATIC_ASSERT(InnerFunctionEntry::kSize == 6);
+}
+
+
+void InnerFunctionRecorder::LogFreeVariable(bool is_one_byte,
+                                            Vector<const byte> name,
+                                            bool is_assigned) {
+  DCHECK(!start_positions_.is_empty());
+  unsigned flags = 0;
+  if (is_one_byte) flags |= kIsOneByteFlag;
+  if (is_assigned) flags |= kIsAssignedFlag;
+  store_.Add(flags);
+  store_.Add(name.length());
+  int words = (name.length() + sizeof(unsigned) - 1) / sizeof(unsigned);
+  if (words == 0) return;
+  Vector<unsigned> block = store_.AddBlock(0, words);
+  MemCopy(block.start(), name.start(), name.length());
+}
+
+
+Vector<const unsigned> InnerFunctionRecorder::GetEntry(int index) const {
+  int begin = entry_offsets_[index];
+  int end = index + 1 < entry_offsets_.length() ? entry_offsets_[index + 1]
+                                                 : store_.length();
+  return Vector<const unsigned>(&store_[begin], end - begin);
+}
+
+
 }  // namespace internal
 }  // namespace v8.
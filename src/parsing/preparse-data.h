@@ -7,6 +7,7 @@
 
 #include "src/allocation.h"
 #include "src/hashmap.h"
+#include "src/list.h"
 #include "src/messages.h"
 #include "src/parsing/preparse-data-format.h"
 
@@ -206,6 +207,42 @@ class CompleteParserRecorder : public ParserRecorder {
 };
 
 
+// Records scope data for inner function declarations that were fully parsed
+// while compiling their enclosing function. A later reparse of the enclosing
+// function (e.g. for optimization) uses the data to skip the inner function
+// bodies while still allocating the outer variables they reference.
+//
+// Each entry is a sequence of unsigned words laid out as described by
+// InnerFunctionEntry, followed by the free variables of the function. A free
+// variable is encoded as a flags word, the length of its name in bytes and the
+// name bytes packed into words.
+class InnerFunctionRecorder {
+ public:
+  enum FreeVariableFlag { kIsOneByteFlag = 1 << 0, kIsAssignedFlag = 1 << 1 };
+
+  InnerFunctionRecorder() {}
+
+  void LogFunction(int start, int end, int literals, int properties,
+                   LanguageMode language_mode, bool uses_super_property,
+                   int free_variable_count);
+
+  // Logs a free variable of the function most recently passed to LogFunction.
+  void LogFreeVariable(bool is_one_byte, Vector<const byte> name,
+                       bool is_assigned);
+
+  int function_count() const { return start_positions_.length(); }
+  int start_position(int index) const { return start_positions_[index]; }
+  Vector<const unsigned> GetEntry(int index) const;
+
+ private:
+  List<int> start_positions_;
+  List<int> entry_offsets_;
+  List<unsigned> store_;
+
+  DISALLOW_COPY_AND_ASSIGN(InnerFunctionRecorder);
+};
+
+
 }  // namespace internal
 }  // namespace v8.
 
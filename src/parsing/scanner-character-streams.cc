@@ -8,7 +8,7 @@
 #include "src/globals.h"
 #include "src/handles.h"
 #include "src/list-inl.h"  // TODO(mstarzinger): Temporary cycle breaker!
-#include "src/objects.h"
+#include "src/objects-inl.h"
 #include "src/unicode-inl.h"
 
 namespace v8 {
@@ -174,6 +174,48 @@ size_t GenericStringUtf16CharacterStream::FillBuffer(size_t from_pos) {
 }
 
 
+// ----------------------------------------------------------------------------
+// OneByteStringUtf16CharacterStream
+
+
+OneByteStringUtf16CharacterStream::OneByteStringUtf16CharacterStream(
+    Handle<String> data, size_t start_position, size_t end_position)
+    : GenericStringUtf16CharacterStream(data, start_position, end_position) {
+  DCHECK(data->IsSeqOneByteString() || data->IsExternalOneByteString());
+}
+
+
+OneByteStringUtf16CharacterStream::~OneByteStringUtf16CharacterStream() {}
+
+
+const uint8_t* OneByteStringUtf16CharacterStream::raw_data() const {
+  if (string_->IsExternalOneByteString()) {
+    return ExternalOneByteString::cast(*string_)->GetChars();
+  }
+  return SeqOneByteString::cast(*string_)->GetChars();
+}
+
+
+Vector<const uint8_t>
+OneByteStringUtf16CharacterStream::UnbufferedOneByteChars() {
+  // In pushback mode the buffered code units are not followed by the data at
+  // the end of the buffer.
+  if (pushback_limit_ != NULL) return Vector<const uint8_t>();
+  size_t position = pos_ + (buffer_end_ - buffer_cursor_);
+  if (position >= length_) return Vector<const uint8_t>();
+  return Vector<const uint8_t>(raw_data() + position,
+                               static_cast<int>(length_ - position));
+}
+
+
+size_t OneByteStringUtf16CharacterStream::FillBuffer(size_t from_pos) {
+  if (from_pos >= length_) return 0;
+  size_t length = Min(kBufferSize, length_ - from_pos);
+  CopyChars(buffer_, raw_data() + from_pos, length);
+  return length;
+}
+
+
 // ----------------------------------------------------------------------------
 // Utf8ToUtf16CharacterStream
 Utf8ToUtf16CharacterStream::Utf8ToUtf16CharacterStream(const byte* data,
@@ -182,7 +224,9 @@ Utf8ToUtf16CharacterStream::Utf8ToUtf16CharacterStream(const byte* data,
       raw_data_(data),
       raw_data_length_(length),
       raw_data_pos_(0),
-      raw_character_position_(0) {
+      raw_character_position_(0),
+      ascii_run_start_(0),
+      ascii_run_end_(0) {
   ReadBlock();
 }
 
@@ -219,6 +263,25 @@ size_t Utf8ToUtf16CharacterStream::CopyChars(uint16_t* dest, size_t length,
 }
 
 
+Vector<const uint8_t> Utf8ToUtf16CharacterStream::UnbufferedOneByteChars() {
+  // The raw position follows the buffered code units unless the stream is in
+  // pushback mode or has been repositioned since the buffer was filled.
+  if (pushback_limit_ != NULL ||
+      raw_character_position_ != pos_ + (buffer_end_ - buffer_cursor_)) {
+    return Vector<const uint8_t>();
+  }
+  if (raw_data_pos_ < ascii_run_start_ || raw_data_pos_ > ascii_run_end_) {
+    ascii_run_start_ = ascii_run_end_ = raw_data_pos_;
+  }
+  while (ascii_run_end_ < raw_data_length_ &&
+         raw_data_[ascii_run_end_] <= unibrow::Utf8::kMaxOneByteChar) {
+    ascii_run_end_++;
+  }
+  int length = static_cast<int>(ascii_run_end_ - raw_data_pos_);
+  return Vector<const uint8_t>(raw_data_ + raw_data_pos_, length);
+}
+
+
 size_t Utf8ToUtf16CharacterStream::BufferSeekForward(size_t delta) {
   size_t old_pos = pos_;
   size_t target_pos = pos_ + delta;
@@ -319,7 +382,13 @@ void Utf8ToUtf16CharacterStream::SetRawPosition(size_t target_position) {
     DCHECK(raw_character_position_ == target_position);
     return;
   }
-  // Spool forwards in the utf8 buffer.
+  // Spool forwards in the utf8 buffer, skipping over known ASCII at once.
+  if (raw_data_pos_ >= ascii_run_start_ && raw_data_pos_ < ascii_run_end_) {
+    size_t ascii_chars = Min(target_position - raw_character_position_,
+                             ascii_run_end_ - raw_data_pos_);
+    raw_data_pos_ += ascii_chars;
+    raw_character_position_ += ascii_chars;
+  }
   while (raw_character_position_ < target_position) {
     if (raw_data_pos_ == raw_data_length_) return;
     size_t old_pos = raw_data_pos_;
@@ -63,6 +63,28 @@ class GenericStringUtf16CharacterStream: public BufferedUtf16CharacterStream {
 };
 
 
+// Generic string stream for sequential and external one-byte strings. The
+// buffer is filled with a bulk copy, and the input following the buffer is
+// exposed for in-place scanning.
+class OneByteStringUtf16CharacterStream
+    : public GenericStringUtf16CharacterStream {
+ public:
+  OneByteStringUtf16CharacterStream(Handle<String> data, size_t start_position,
+                                    size_t end_position);
+  ~OneByteStringUtf16CharacterStream() override;
+
+  Vector<const uint8_t> UnbufferedOneByteChars() override;
+
+ protected:
+  size_t FillBuffer(size_t position) override;
+
+ private:
+  // Sequential strings can be moved by the GC, so the characters are looked
+  // up on every access instead of being cached.
+  const uint8_t* raw_data() const;
+};
+
+
 // Utf16 stream based on a literal UTF-8 string.
 class Utf8ToUtf16CharacterStream: public BufferedUtf16CharacterStream {
  public:
@@ -72,6 +94,8 @@ class Utf8ToUtf16CharacterStream: public BufferedUtf16CharacterStream {
   static size_t CopyChars(uint16_t* dest, size_t length, const byte* src,
                           size_t* src_pos, size_t src_length);
 
+  Vector<const uint8_t> UnbufferedOneByteChars() override;
+
  protected:
   size_t BufferSeekForward(size_t delta) override;
   size_t FillBuffer(size_t char_position) override;
@@ -83,6 +107,10 @@ class Utf8ToUtf16CharacterStream: public BufferedUtf16CharacterStream {
   // The character position of the character at raw_data[raw_data_pos_].
   // Not necessarily the same as pos_.
   size_t raw_character_position_;
+  // The raw data in [ascii_run_start_, ascii_run_end_) is known to be ASCII,
+  // i.e. one byte per character.
+  size_t ascii_run_start_;
+  size_t ascii_run_end_;
 };
 
 
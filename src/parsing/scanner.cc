@@ -12,6 +12,7 @@
 
 #include "src/ast/ast-value-factory.h"
 #include "src/char-predicates-inl.h"
+#include "src/code-unit-word.h"
 #include "src/conversions-inl.h"
 #include "src/list-inl.h"
 #include "src/parsing/parser.h"
@@ -33,6 +34,95 @@ bool Utf16CharacterStream::SetBookmark() { return false; }
 void Utf16CharacterStream::ResetToBookmark() { UNREACHABLE(); }
 
 
+// ----------------------------------------------------------------------------
+// Block scanning helpers
+
+namespace {
+
+inline bool IsLineTerminatorCodeUnit(uint16_t c) {
+  return c == '\n' || c == '\r' || (c & 0xFFFE) == 0x2028;
+}
+
+
+// Code units other than line terminators.
+struct LineTerminatorFreeRun {
+  bool Accepts(uint16_t c) const { return !IsLineTerminatorCodeUnit(c); }
+  template <typename Char>
+  bool Rejects(uintptr_t word) const {
+    return CodeUnitWord<Char>::AnyLineTerminator(word);
+  }
+  template <typename Char>
+  int PrefixLength(Vector<const Char> chars) const {
+    return WordwisePrefixLength(*this, chars);
+  }
+};
+
+
+// Code units other than line terminators and '*'.
+struct CommentTextRun {
+  bool Accepts(uint16_t c) const {
+    return c != '*' && !IsLineTerminatorCodeUnit(c);
+  }
+  template <typename Char>
+  bool Rejects(uintptr_t word) const {
+    return CodeUnitWord<Char>::AnyEquals(word, '*') ||
+           CodeUnitWord<Char>::AnyLineTerminator(word);
+  }
+  template <typename Char>
+  int PrefixLength(Vector<const Char> chars) const {
+    return WordwisePrefixLength(*this, chars);
+  }
+};
+
+
+// Printable ASCII characters other than the quote and backslash.
+struct PlainStringRun {
+  explicit PlainStringRun(uc32 quote) : quote_(static_cast<uint16_t>(quote)) {}
+  bool Accepts(uint16_t c) const {
+    return c >= 0x20 && c <= unibrow::Utf8::kMaxOneByteChar && c != quote_ &&
+           c != '\\';
+  }
+  template <typename Char>
+  bool Rejects(uintptr_t word) const {
+    typedef CodeUnitWord<Char> Word;
+    return Word::AnyNonAscii(word) || Word::AnyLessThan(word, 0x20) ||
+           Word::AnyEquals(word, static_cast<Char>(quote_)) ||
+           Word::AnyEquals(word, '\\');
+  }
+  template <typename Char>
+  int PrefixLength(Vector<const Char> chars) const {
+    return WordwisePrefixLength(*this, chars);
+  }
+
+ private:
+  uint16_t quote_;
+};
+
+
+// Spaces and tabs. Runs are short, so there is no word-wise test.
+struct SpacesAndTabsRun {
+  template <typename Char>
+  int PrefixLength(Vector<const Char> chars) const {
+    int i = 0;
+    while (i < chars.length() && (chars[i] == ' ' || chars[i] == '\t')) i++;
+    return i;
+  }
+};
+
+
+// ASCII identifier parts.
+struct AsciiIdentifierPartRun {
+  template <typename Char>
+  int PrefixLength(Vector<const Char> chars) const {
+    int i = 0;
+    while (i < chars.length() && IsAsciiIdentifier(chars[i])) i++;
+    return i;
+  }
+};
+
+}  // namespace
+
+
 // ----------------------------------------------------------------------------
 // Scanner
 
@@ -293,6 +383,10 @@ bool Scanner::SkipWhiteSpace() {
 
   while (true) {
     while (true) {
+      if (c0_ == ' ' || c0_ == '\t') {
+        SkipSpacesAndTabs();
+        continue;
+      }
       // The unicode cache accepts unsigned inputs.
       if (c0_ < 0) break;
       // Advance as long as character is a WhiteSpace or LineTerminator.
@@ -330,6 +424,68 @@ bool Scanner::SkipWhiteSpace() {
 }
 
 
+template <typename Run>
+void Scanner::ConsumeRun(const Run& run, bool add_to_literal) {
+  Vector<const uint16_t> buffered = source_->BufferedCodeUnits();
+  int length = run.PrefixLength(buffered);
+  if (add_to_literal) {
+    next_.literal_chars->AddOneByteChars(buffered.SubVector(0, length));
+  }
+  if (length == buffered.length()) {
+    Vector<const uint8_t> unbuffered = source_->UnbufferedOneByteChars();
+    int unbuffered_length = run.PrefixLength(unbuffered);
+    if (add_to_literal) {
+      next_.literal_chars->AddOneByteChars(
+          unbuffered.SubVector(0, unbuffered_length));
+    }
+    length += unbuffered_length;
+  }
+  source_->SeekForward(length);
+}
+
+
+void Scanner::SkipSpacesAndTabs() {
+  DCHECK(c0_ == ' ' || c0_ == '\t');
+  ConsumeRun(SpacesAndTabsRun(), false);
+  Advance();
+}
+
+
+void Scanner::SkipToLineTerminator() {
+  DCHECK(c0_ >= 0 && !unicode_cache_->IsLineTerminator(c0_));
+  ConsumeRun(LineTerminatorFreeRun(), false);
+  Advance();
+}
+
+
+void Scanner::SkipMultiLineCommentText() {
+  DCHECK(c0_ >= 0 && c0_ != '*' && !unicode_cache_->IsLineTerminator(c0_));
+  ConsumeRun(CommentTextRun(), false);
+  Advance();
+}
+
+
+void Scanner::AddAsciiIdentifierPart() {
+  DCHECK(IsAsciiIdentifier(c0_));
+  do {
+    AddLiteralChar(c0_);
+    ConsumeRun(AsciiIdentifierPartRun(), true);
+    Advance<false, false>();
+  } while (IsAsciiIdentifier(c0_));
+}
+
+
+void Scanner::AddPlainStringChars(uc32 quote) {
+  DCHECK(c0_ >= 0 &&
+         c0_ <= static_cast<uc32>(unibrow::Utf8::kMaxOneByteChar));
+  DCHECK(c0_ != quote && c0_ != '\\' &&
+         !unicode_cache_->IsLineTerminator(c0_));
+  AddLiteralChar(c0_);
+  ConsumeRun(PlainStringRun(quote), true);
+  Advance<false, false>();
+}
+
+
 Token::Value Scanner::SkipSingleLineComment() {
   Advance();
 
@@ -339,7 +495,7 @@ Token::Value Scanner::SkipSingleLineComment() {
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
   while (c0_ >= 0 && !unicode_cache_->IsLineTerminator(c0_)) {
-    Advance();
+    SkipToLineTerminator();
   }
 
   return Token::WHITESPACE;
@@ -412,6 +568,10 @@ Token::Value Scanner::SkipMultiLineComment() {
   Advance();
 
   while (c0_ >= 0) {
+    if (c0_ != '*' && !unicode_cache_->IsLineTerminator(c0_)) {
+      SkipMultiLineCommentText();
+      continue;
+    }
     uc32 ch = c0_;
     Advance();
     if (c0_ >= 0 && unicode_cache_->IsLineTerminator(ch)) {
@@ -836,10 +996,8 @@ Token::Value Scanner::ScanString() {
       Advance<false, false>();
       return Token::STRING;
     }
-    uc32 c = c0_;
-    if (c == '\\') break;
-    Advance<false, false>();
-    AddLiteralChar(c);
+    if (c0_ == '\\') break;
+    AddPlainStringChars(quote);
   }
 
   while (c0_ != quote && c0_ >= 0
@@ -1251,14 +1409,7 @@ Token::Value Scanner::ScanIdentifierOrKeyword() {
     if (IsDecimalDigit(c0_) || IsInRange(c0_, 'A', 'Z') || c0_ == '_' ||
         c0_ == '$') {
       // Identifier starting with lowercase.
-      uc32 first_char = c0_;
-      Advance<false, false>();
-      AddLiteralChar(first_char);
-      while (IsAsciiIdentifier(c0_)) {
-        uc32 first_char = c0_;
-        Advance<false, false>();
-        AddLiteralChar(first_char);
-      }
+      AddAsciiIdentifierPart();
       if (c0_ <= kMaxAscii && c0_ != '\\') {
         literal.Complete();
         return Token::IDENTIFIER;
@@ -1272,11 +1423,7 @@ Token::Value Scanner::ScanIdentifierOrKeyword() {
 
     HandleLeadSurrogate();
   } else if (IsInRange(c0_, 'A', 'Z') || c0_ == '_' || c0_ == '$') {
-    do {
-      uc32 first_char = c0_;
-      Advance<false, false>();
-      AddLiteralChar(first_char);
-    } while (IsAsciiIdentifier(c0_));
+    AddAsciiIdentifierPart();
 
     if (c0_ <= kMaxAscii && c0_ != '\\') {
       literal.Complete();
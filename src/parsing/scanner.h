@@ -73,6 +73,23 @@ class Utf16CharacterStream {
     return SlowSeekForward(code_unit_count);
   }
 
+  // Returns the code units that are buffered after the current position,
+  // i.e. the ones the following calls to Advance will return, without
+  // consuming them. A prefix of them can then be consumed with SeekForward.
+  // The result may be empty even if the end of input hasn't been reached.
+  inline Vector<const uint16_t> BufferedCodeUnits() const {
+    return Vector<const uint16_t>(
+        buffer_cursor_, static_cast<int>(buffer_end_ - buffer_cursor_));
+  }
+
+  // Returns the input that directly follows the buffered code units if it is
+  // one-byte and can be read in place, i.e. without first copying it into
+  // the UTF-16 buffer. Any prefix of it can be consumed, together with all
+  // buffered code units, with SeekForward. The result may be empty.
+  virtual Vector<const uint8_t> UnbufferedOneByteChars() {
+    return Vector<const uint8_t>();
+  }
+
   // Pushes back the most recently read UTF-16 code unit (or negative
   // value if at end of input), i.e., the value returned by the most recent
   // call to Advance.
@@ -181,6 +198,20 @@ class LiteralBuffer {
     }
   }
 
+  // Adds a run of code units that all fit into one byte.
+  template <typename Char>
+  void AddOneByteChars(Vector<const Char> code_units) {
+    if (!is_one_byte_) {
+      for (int i = 0; i < code_units.length(); i++) AddChar(code_units[i]);
+      return;
+    }
+    int new_position = position_ + code_units.length();
+    if (new_position > backing_store_.length()) ExpandBuffer(new_position);
+    CopyChars(backing_store_.start() + position_, code_units.start(),
+              code_units.length());
+    position_ = new_position;
+  }
+
   bool is_one_byte() const { return is_one_byte_; }
 
   bool is_contextual_keyword(Vector<const char> keyword) const {
@@ -240,8 +271,8 @@ class LiteralBuffer {
     return new_capacity;
   }
 
-  void ExpandBuffer() {
-    Vector<byte> new_store = Vector<byte>::New(NewCapacity(kInitialCapacity));
+  void ExpandBuffer(int min_capacity = kInitialCapacity) {
+    Vector<byte> new_store = Vector<byte>::New(NewCapacity(min_capacity));
     MemCopy(new_store.start(), backing_store_.start(), position_);
     backing_store_.Dispose();
     backing_store_ = new_store;
@@ -545,6 +576,29 @@ class Scanner {
     if (check_surrogate) HandleLeadSurrogate();
   }
 
+  // Block-scanning fast paths. They look at the code units buffered by the
+  // character stream following c0_, consume the longest run that the
+  // character-at-a-time loops would treat uniformly and leave c0_ at the
+  // first code unit that needs the general path. Runs that extend past the
+  // buffer continue in the stream's unbuffered one-byte input, if any.
+
+  // Skips spaces and tabs.
+  void SkipSpacesAndTabs();
+  // Skips code units other than line terminators.
+  void SkipToLineTerminator();
+  // Skips code units other than line terminators and '*'.
+  void SkipMultiLineCommentText();
+  // Adds c0_ and the ASCII identifier part characters following it to the
+  // literal.
+  void AddAsciiIdentifierPart();
+  // Adds c0_ and the printable ASCII characters following it to the literal,
+  // stopping at |quote| and backslashes.
+  void AddPlainStringChars(uc32 quote);
+  // Consumes the run of code units following c0_ that |run| accepts, adding
+  // them to the literal if |add_to_literal| is set. Does not touch c0_.
+  template <typename Run>
+  void ConsumeRun(const Run& run, bool add_to_literal);
+
   void HandleLeadSurrogate() {
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
       uc32 c1 = source_->Advance();
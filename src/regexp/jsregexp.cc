@@ -18,6 +18,7 @@
 #include "src/regexp/regexp-macro-assembler.h"
 #include "src/regexp/regexp-macro-assembler-irregexp.h"
 #include "src/regexp/regexp-macro-assembler-tracer.h"
+#include "src/regexp/regexp-nfa.h"
 #include "src/regexp/regexp-parser.h"
 #include "src/regexp/regexp-stack.h"
 #include "src/runtime/runtime.h"
@@ -149,6 +150,12 @@ MaybeHandle<Object> RegExpImpl::Compile(Handle<JSRegExp> re,
     return re;
   }
   pattern = String::Flatten(pattern);
+  if (compilation_cache->HasBackingStore() &&
+      compilation_cache->LookupRegExpInBackingStore(pattern, flags)
+          .ToHandle(&cached)) {
+    re->set_data(*cached);
+    return re;
+  }
   PostponeInterruptsScope postpone(isolate);
   RegExpCompileData parse_result;
   FlatStringReader reader(isolate, pattern);
@@ -179,6 +186,13 @@ MaybeHandle<Object> RegExpImpl::Compile(Handle<JSRegExp> re,
       has_been_compiled = true;
     }
   }
+  if (!has_been_compiled &&
+      ((flags & JSRegExp::kLinear) != 0 ||
+       (FLAG_regexp_linear_fallback &&
+        RegExpNfa::IsProneToBacktracking(parse_result.tree)))) {
+    has_been_compiled = LinearCompile(re, pattern, flags, &zone,
+                                      &parse_result);
+  }
   if (!has_been_compiled) {
     IrregexpInitialize(re, pattern, flags, parse_result.capture_count);
   }
@@ -199,7 +213,8 @@ MaybeHandle<Object> RegExpImpl::Exec(Handle<JSRegExp> regexp,
   switch (regexp->TypeTag()) {
     case JSRegExp::ATOM:
       return AtomExec(regexp, subject, index, last_match_info);
-    case JSRegExp::IRREGEXP: {
+    case JSRegExp::IRREGEXP:
+    case JSRegExp::LINEAR: {
       return IrregexpExec(regexp, subject, index, last_match_info);
     }
     default:
@@ -247,7 +262,10 @@ int RegExpImpl::AtomExecRaw(Handle<JSRegExp> regexp,
   DCHECK(0 <= index);
   DCHECK(index <= subject->length());
 
-  subject = String::Flatten(subject);
+  // A single match from the start of a rope is searched for in place, see
+  // StringMatch.
+  bool search_segments = index == 0 && output_size == 2 && !subject->IsFlat();
+  if (!search_segments) subject = String::Flatten(subject);
   DisallowHeapAllocation no_gc;  // ensure vectors stay valid
 
   String* needle = String::cast(regexp->DataAt(JSRegExp::kAtomPatternIndex));
@@ -259,6 +277,23 @@ int RegExpImpl::AtomExecRaw(Handle<JSRegExp> regexp,
     return RegExpImpl::RE_FAILURE;
   }
 
+  if (search_segments) {
+    String::FlatContent needle_content = needle->GetFlatContent();
+    if (needle_content.IsOneByte()) {
+      SegmentedStringSearch<uint8_t> search(isolate,
+                                            needle_content.ToOneByteVector());
+      index = search.Search(*subject, index);
+    } else {
+      SegmentedStringSearch<uc16> search(isolate,
+                                         needle_content.ToUC16Vector());
+      index = search.Search(*subject, index);
+    }
+    if (index == -1) return 0;
+    output[0] = index;
+    output[1] = index + needle_len;
+    return 1;
+  }
+
   for (int i = 0; i < output_size; i += 2) {
     String::FlatContent needle_content = needle->GetFlatContent();
     String::FlatContent subject_content = subject->GetFlatContent();
@@ -402,6 +437,12 @@ bool RegExpImpl::CompileIrregexp(Handle<JSRegExp> re,
     SetIrregexpMaxRegisterCount(*data, result.num_registers);
   }
 
+  // Let other isolates and later runs reuse the code.
+  CompilationCache* compilation_cache = isolate->compilation_cache();
+  if (compilation_cache->HasBackingStore()) {
+    compilation_cache->PutRegExpInBackingStore(pattern, flags, data);
+  }
+
   return true;
 }
 
@@ -450,10 +491,35 @@ void RegExpImpl::IrregexpInitialize(Handle<JSRegExp> re,
 }
 
 
+bool RegExpImpl::LinearCompile(Handle<JSRegExp> re, Handle<String> pattern,
+                               JSRegExp::Flags flags, Zone* zone,
+                               RegExpCompileData* compile_data) {
+  Isolate* isolate = re->GetIsolate();
+  Handle<ByteArray> program;
+  if (!RegExpNfa::Compile(isolate, zone, compile_data->tree, flags,
+                          compile_data->capture_count).ToHandle(&program)) {
+    return false;
+  }
+  isolate->factory()->SetRegExpIrregexpData(re, JSRegExp::LINEAR, pattern,
+                                            flags,
+                                            compile_data->capture_count);
+  // The program works on both representations of the subject.
+  re->SetDataAt(JSRegExp::kIrregexpLatin1CodeIndex, *program);
+  re->SetDataAt(JSRegExp::kIrregexpUC16CodeIndex, *program);
+  return true;
+}
+
+
 int RegExpImpl::IrregexpPrepare(Handle<JSRegExp> regexp,
                                 Handle<String> subject) {
   subject = String::Flatten(subject);
 
+  // The NFA engine is compiled eagerly and only needs room for the
+  // captures.
+  if (regexp->TypeTag() == JSRegExp::LINEAR) {
+    return (IrregexpNumberOfCaptures(FixedArray::cast(regexp->data())) + 1) * 2;
+  }
+
   // Check representation of the underlying storage.
   bool is_one_byte = subject->IsOneByteRepresentationUnderneath();
   if (!EnsureCompiledIrregexp(regexp, subject, is_one_byte)) return -1;
@@ -486,6 +552,12 @@ int RegExpImpl::IrregexpExecRaw(Handle<JSRegExp> regexp,
   DCHECK(index <= subject->length());
   DCHECK(subject->IsFlat());
 
+  if (regexp->TypeTag() == JSRegExp::LINEAR) {
+    Handle<ByteArray> program(IrregexpByteCode(*irregexp, true), isolate);
+    return RegExpNfa::Match(isolate, program, subject, index, output,
+                            output_size);
+  }
+
   bool is_one_byte = subject->IsOneByteRepresentationUnderneath();
 
 #ifndef V8_INTERPRETED_REGEXP
@@ -566,7 +638,8 @@ MaybeHandle<Object> RegExpImpl::IrregexpExec(Handle<JSRegExp> regexp,
                                              int previous_index,
                                              Handle<JSArray> last_match_info) {
   Isolate* isolate = regexp->GetIsolate();
-  DCHECK_EQ(regexp->TypeTag(), JSRegExp::IRREGEXP);
+  DCHECK(regexp->TypeTag() == JSRegExp::IRREGEXP ||
+         regexp->TypeTag() == JSRegExp::LINEAR);
 
   // Prepare space for the return values.
 #if defined(V8_INTERPRETED_REGEXP) && defined(DEBUG)
@@ -662,9 +735,14 @@ RegExpImpl::GlobalCache::GlobalCache(Handle<JSRegExp> regexp,
       num_matches_ = -1;  // Signal exception.
       return;
     }
+    // The NFA engine returns one match per call, like the interpreter. So
+    // does native code compiled for a non-global regexp, e.g. for split.
+    if (regexp_->TypeTag() == JSRegExp::LINEAR ||
+        (regexp_->GetFlags() & JSRegExp::kGlobal) == 0) {
+      interpreted = true;
+    }
   }
 
-  DCHECK_NE(0, regexp->GetFlags() & JSRegExp::kGlobal);
   if (!interpreted) {
     register_array_size_ =
         Max(registers_per_match_, Isolate::kJSRegexpStaticOffsetsVectorSize);
@@ -19,6 +19,7 @@ class RegExpMacroAssembler;
 class RegExpNode;
 class RegExpTree;
 class BoyerMooreLookahead;
+struct RegExpCompileData;
 
 class RegExpImpl {
  public:
@@ -64,6 +65,12 @@ class RegExpImpl {
                           JSRegExp::Flags flags,
                           Handle<String> match_pattern);
 
+  // Prepares a JSRegExp object for the linear-time NFA engine. Returns false
+  // if the NFA engine does not support the pattern.
+  static bool LinearCompile(Handle<JSRegExp> re, Handle<String> pattern,
+                            JSRegExp::Flags flags, Zone* zone,
+                            RegExpCompileData* compile_data);
+
 
   static int AtomExecRaw(Handle<JSRegExp> regexp,
                          Handle<String> subject,
@@ -136,9 +143,11 @@ class RegExpImpl {
 
     INLINE(bool HasException()) { return num_matches_ < 0; }
 
-   private:
+    // The index the search continues from after a zero-length match at
+    // |last_index|.
     int AdvanceZeroLength(int last_index);
 
+   private:
     int num_matches_;
     int max_matches_;
     int current_match_index_;
@@ -0,0 +1,675 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-nfa.h"
+
+#include "src/char-predicates-inl.h"
+#include "src/factory.h"
+#include "src/list-inl.h"
+#include "src/objects-inl.h"
+#include "src/regexp/regexp-ast.h"
+
+namespace v8 {
+namespace internal {
+
+// A program is a sequence of int instructions preceded by a header. Jump
+// targets are absolute indices into the program.
+enum NfaOpcode {
+  // Consumes the character given by the operand.
+  kNfaChar,
+  // Consumes a character in one of the ranges given by the operands. The
+  // first operand is the number of ranges, followed by the inclusive bounds
+  // of each range in ascending order.
+  kNfaClass,
+  // Continues at both operands, preferring the first one.
+  kNfaSplit,
+  kNfaJump,
+  // Stores the current position to the register given by the operand.
+  kNfaSave,
+  // Resets the registers from the first to the second operand to -1.
+  kNfaClear,
+  // Stores the current position to the register given by the operand and
+  // fails if it is unchanged at the next kNfaCheckProgress. Quantifiers use
+  // this to reject iterations that match the empty string.
+  kNfaMark,
+  kNfaCheckProgress,
+  // Checks the RegExpAssertion::AssertionType given by the operand.
+  kNfaAssert,
+  kNfaMatch
+};
+
+// Number of registers each thread needs, including the capture registers.
+static const int kNfaRegisterCountIndex = 0;
+static const int kNfaCaptureRegisterCountIndex = 1;
+// Maximal number of threads alive at the same position, which is the number
+// of consuming and kNfaMatch instructions.
+static const int kNfaThreadCountIndex = 2;
+// Whether the regexp is sticky, i.e. only matches at the start index.
+static const int kNfaStickyIndex = 3;
+static const int kNfaHeaderLength = 4;
+
+// The matcher tells apart threads that reach an instruction with different
+// kNfaMark registers equal to the current position, which costs space
+// exponential in the number of such registers.
+static const int kNfaMaxMarkRegisters = 4;
+
+
+class NfaCompiler : public RegExpVisitor {
+ public:
+  NfaCompiler(Isolate* isolate, Zone* zone, JSRegExp::Flags flags,
+              int capture_count)
+      : isolate_(isolate),
+        zone_(zone),
+        ignore_case_((flags & JSRegExp::kIgnoreCase) != 0),
+        sticky_((flags & JSRegExp::kSticky) != 0),
+        code_(64, zone),
+        capture_register_count_((capture_count + 1) * 2),
+        thread_count_(0),
+        mark_depth_(0),
+        max_mark_depth_(0),
+        failed_(false) {}
+
+  // Returns NULL if |tree| cannot be compiled.
+  ZoneList<int>* Compile(RegExpTree* tree) {
+    for (int i = 0; i < kNfaHeaderLength; i++) code_.Add(0, zone_);
+    Emit(kNfaSave, RegExpCapture::StartRegister(0));
+    tree->Accept(this, NULL);
+    Emit(kNfaSave, RegExpCapture::EndRegister(0));
+    Emit(kNfaMatch);
+    thread_count_++;
+    if (failed_) return NULL;
+    code_[kNfaRegisterCountIndex] = capture_register_count_ + max_mark_depth_;
+    code_[kNfaCaptureRegisterCountIndex] = capture_register_count_;
+    code_[kNfaThreadCountIndex] = thread_count_;
+    code_[kNfaStickyIndex] = sticky_ ? 1 : 0;
+    return &code_;
+  }
+
+#define DECLARE_VISIT(Name) \
+  void* Visit##Name(RegExp##Name* node, void* data) override;
+  FOR_EACH_REG_EXP_TREE_TYPE(DECLARE_VISIT)
+#undef DECLARE_VISIT
+
+ private:
+  int pc() const { return code_.length(); }
+
+  void Emit(int word) {
+    code_.Add(word, zone_);
+    if (code_.length() > RegExpNfa::kMaxProgramLength) failed_ = true;
+  }
+
+  void Emit(int opcode, int operand) {
+    Emit(opcode);
+    Emit(operand);
+  }
+
+  // Emits a jump or split whose targets are patched later.
+  int EmitSplit() {
+    int split = pc();
+    Emit(kNfaSplit, 0);
+    Emit(0);
+    return split;
+  }
+
+  int EmitJump() {
+    int jump = pc();
+    Emit(kNfaJump, 0);
+    return jump;
+  }
+
+  void EmitChar(uc16 c);
+  void EmitClass(ZoneList<CharacterRange>* ranges);
+  void EmitIteration(RegExpQuantifier* node, bool check_progress);
+
+  Isolate* isolate_;
+  Zone* zone_;
+  bool ignore_case_;
+  bool sticky_;
+  ZoneList<int> code_;
+  int capture_register_count_;
+  int thread_count_;
+  // Quantifiers nested at the same depth are never active at the same time
+  // and share the register for kNfaMark.
+  int mark_depth_;
+  int max_mark_depth_;
+  bool failed_;
+};
+
+
+void NfaCompiler::EmitChar(uc16 c) {
+  if (ignore_case_) {
+    ZoneList<CharacterRange>* ranges =
+        CharacterRange::List(zone_, CharacterRange::Singleton(c));
+    CharacterRange::AddCaseEquivalents(isolate_, zone_, ranges, false);
+    if (ranges->length() > 1) {
+      CharacterRange::Canonicalize(ranges);
+      EmitClass(ranges);
+      return;
+    }
+  }
+  Emit(kNfaChar, c);
+  thread_count_++;
+}
+
+
+void NfaCompiler::EmitClass(ZoneList<CharacterRange>* ranges) {
+  DCHECK(CharacterRange::IsCanonical(ranges));
+  Emit(kNfaClass, ranges->length());
+  for (int i = 0; i < ranges->length(); i++) {
+    Emit(ranges->at(i).from());
+    Emit(ranges->at(i).to());
+  }
+  thread_count_++;
+}
+
+
+void* NfaCompiler::VisitDisjunction(RegExpDisjunction* node, void* data) {
+  ZoneList<RegExpTree*>* alternatives = node->alternatives();
+  ZoneList<int> jumps_to_end(alternatives->length(), zone_);
+  for (int i = 0; i < alternatives->length() - 1; i++) {
+    int split = EmitSplit();
+    code_[split + 1] = pc();
+    alternatives->at(i)->Accept(this, data);
+    jumps_to_end.Add(EmitJump(), zone_);
+    code_[split + 2] = pc();
+  }
+  alternatives->last()->Accept(this, data);
+  for (int i = 0; i < jumps_to_end.length(); i++) {
+    code_[jumps_to_end[i] + 1] = pc();
+  }
+  return NULL;
+}
+
+
+void* NfaCompiler::VisitAlternative(RegExpAlternative* node, void* data) {
+  ZoneList<RegExpTree*>* nodes = node->nodes();
+  for (int i = 0; i < nodes->length() && !failed_; i++) {
+    nodes->at(i)->Accept(this, data);
+  }
+  return NULL;
+}
+
+
+void* NfaCompiler::VisitAssertion(RegExpAssertion* node, void* data) {
+  Emit(kNfaAssert, node->assertion_type());
+  return NULL;
+}
+
+
+void* NfaCompiler::VisitCharacterClass(RegExpCharacterClass* node,
+                                       void* data) {
+  ZoneList<CharacterRange>* ranges = new (zone_) ZoneList<CharacterRange>(
+      *node->ranges(zone_), zone_);
+  // None of the standard character classes changes when ignoring case.
+  if (ignore_case_ && !node->is_standard(zone_)) {
+    CharacterRange::AddCaseEquivalents(isolate_, zone_, ranges, false);
+  }
+  CharacterRange::Canonicalize(ranges);
+  if (node->is_negated()) {
+    ZoneList<CharacterRange>* negated =
+        new (zone_) ZoneList<CharacterRange>(ranges->length() + 1, zone_);
+    CharacterRange::Negate(ranges, negated, zone_);
+    ranges = negated;
+  }
+  EmitClass(ranges);
+  return NULL;
+}
+
+
+void* NfaCompiler::VisitAtom(RegExpAtom* node, void* data) {
+  Vector<const uc16> chars = node->data();
+  for (int i = 0; i < chars.length(); i++) EmitChar(chars[i]);
+  return NULL;
+}
+
+
+void NfaCompiler::EmitIteration(RegExpQuantifier* node, bool check_progress) {
+  int mark_register = capture_register_count_ + mark_depth_;
+  if (check_progress) {
+    Emit(kNfaMark, mark_register);
+    mark_depth_++;
+    max_mark_depth_ = Max(max_mark_depth_, mark_depth_);
+    if (max_mark_depth_ > kNfaMaxMarkRegisters) failed_ = true;
+  }
+  // Captures inside the body are reset at the start of each iteration.
+  Interval captures = node->CaptureRegisters();
+  if (!captures.is_empty()) {
+    Emit(kNfaClear, captures.from());
+    Emit(captures.to());
+  }
+  node->body()->Accept(this, NULL);
+  if (check_progress) {
+    mark_depth_--;
+    Emit(kNfaCheckProgress, mark_register);
+  }
+}
+
+
+void* NfaCompiler::VisitQuantifier(RegExpQuantifier* node, void* data) {
+  if (node->is_possessive()) {
+    failed_ = true;
+    return NULL;
+  }
+  bool greedy = node->is_greedy();
+  // Only the optional iterations may not match the empty string.
+  bool check_progress = node->body()->min_match() == 0;
+  for (int i = 0; i < node->min() && !failed_; i++) {
+    EmitIteration(node, false);
+  }
+  if (node->max() == RegExpTree::kInfinity) {
+    int loop = EmitSplit();
+    code_[loop + (greedy ? 1 : 2)] = pc();
+    EmitIteration(node, check_progress);
+    code_[EmitJump() + 1] = loop;
+    code_[loop + (greedy ? 2 : 1)] = pc();
+  } else {
+    ZoneList<int> splits(node->max() - node->min(), zone_);
+    for (int i = node->min(); i < node->max() && !failed_; i++) {
+      int split = EmitSplit();
+      code_[split + (greedy ? 1 : 2)] = pc();
+      splits.Add(split, zone_);
+      EmitIteration(node, check_progress);
+    }
+    for (int i = 0; i < splits.length(); i++) {
+      code_[splits[i] + (greedy ? 2 : 1)] = pc();
+    }
+  }
+  return NULL;
+}
+
+
+void* NfaCompiler::VisitCapture(RegExpCapture* node, void* data) {
+  Emit(kNfaSave, RegExpCapture::StartRegister(node->index()));
+  node->body()->Accept(this, data);
+  Emit(kNfaSave, RegExpCapture::EndRegister(node->index()));
+  return NULL;
+}
+
+
+void* NfaCompiler::VisitLookaround(RegExpLookaround* node, void* data) {
+  failed_ = true;
+  return NULL;
+}
+
+
+void* NfaCompiler::VisitBackReference(RegExpBackReference* node,
+                                      void* data) {
+  failed_ = true;
+  return NULL;
+}
+
+
+void* NfaCompiler::VisitEmpty(RegExpEmpty* node, void* data) { return NULL; }
+
+
+void* NfaCompiler::VisitText(RegExpText* node, void* data) {
+  ZoneList<TextElement>* elements = node->elements();
+  for (int i = 0; i < elements->length(); i++) {
+    elements->at(i).tree()->Accept(this, data);
+  }
+  return NULL;
+}
+
+
+MaybeHandle<ByteArray> RegExpNfa::Compile(Isolate* isolate, Zone* zone,
+                                          RegExpTree* tree,
+                                          JSRegExp::Flags flags,
+                                          int capture_count) {
+  // Unicode regexps match surrogate pairs as one character, which the
+  // program cannot express.
+  if ((flags & JSRegExp::kUnicode) != 0) return MaybeHandle<ByteArray>();
+  NfaCompiler compiler(isolate, zone, flags, capture_count);
+  ZoneList<int>* code = compiler.Compile(tree);
+  if (code == NULL) return MaybeHandle<ByteArray>();
+  Handle<ByteArray> program =
+      isolate->factory()->NewByteArray(code->length() * kIntSize, TENURED);
+  MemCopy(program->GetDataStartAddress(), code->ToVector().start(),
+          code->length() * kIntSize);
+  return program;
+}
+
+
+static int UnboundedNestingDepth(RegExpTree* tree) {
+  if (tree->IsQuantifier()) {
+    RegExpQuantifier* quantifier = tree->AsQuantifier();
+    int depth = UnboundedNestingDepth(quantifier->body());
+    return quantifier->max() == RegExpTree::kInfinity ? depth + 1 : depth;
+  }
+  ZoneList<RegExpTree*>* children = NULL;
+  if (tree->IsDisjunction()) {
+    children = tree->AsDisjunction()->alternatives();
+  } else if (tree->IsAlternative()) {
+    children = tree->AsAlternative()->nodes();
+  } else if (tree->IsCapture()) {
+    return UnboundedNestingDepth(tree->AsCapture()->body());
+  } else if (tree->IsLookaround()) {
+    return UnboundedNestingDepth(tree->AsLookaround()->body());
+  } else {
+    return 0;
+  }
+  int depth = 0;
+  for (int i = 0; i < children->length(); i++) {
+    depth = Max(depth, UnboundedNestingDepth(children->at(i)));
+  }
+  return depth;
+}
+
+
+bool RegExpNfa::IsProneToBacktracking(RegExpTree* tree) {
+  return UnboundedNestingDepth(tree) >= 2;
+}
+
+
+// Simulates the NFA with one thread per reachable instruction. Threads are
+// ordered by priority, and when two threads reach the same instruction at
+// the same position only the one with the higher priority survives. This
+// is the one a backtracking engine would have continued with. Before a
+// character is consumed, threads whose kNfaMark registers differ in being
+// equal to the current position can still take different paths and are
+// kept apart.
+template <typename Char>
+class NfaMatcher {
+ public:
+  NfaMatcher(const int* program, int* marks, int stamp_offset,
+             Vector<const Char> subject)
+      : program_(program),
+        subject_(subject),
+        sticky_(program[kNfaStickyIndex] != 0),
+        register_count_(program[kNfaRegisterCountIndex]),
+        capture_register_count_(program[kNfaCaptureRegisterCountIndex]),
+        thread_count_(program[kNfaThreadCountIndex]),
+        mark_count_(register_count_ - capture_register_count_),
+        marks_(marks),
+        stamp_offset_(stamp_offset),
+        scratch_(register_count_),
+        stack_(8) {}
+
+  bool Match(int index, int32_t* output);
+
+ private:
+  // Threads to run at one position, in priority order.
+  class ThreadList {
+   public:
+    ThreadList(int capacity, int register_count)
+        : register_count_(register_count),
+          length_(0),
+          pcs_(capacity),
+          registers_(capacity * register_count) {}
+
+    int length() const { return length_; }
+    void Clear() { length_ = 0; }
+    int pc(int i) const { return pcs_[i]; }
+    int* registers(int i) { return &registers_[i * register_count_]; }
+
+    void Add(int pc, const int* registers) {
+      pcs_[length_] = pc;
+      MemCopy(this->registers(length_), registers,
+              register_count_ * sizeof(int));
+      length_++;
+    }
+
+   private:
+    int register_count_;
+    int length_;
+    ScopedVector<int> pcs_;
+    ScopedVector<int> registers_;
+  };
+
+  // An instruction to explore, or a register to restore once the
+  // instructions explored after it are done.
+  struct Frame {
+    int pc;
+    int restore_register;
+    int restore_value;
+  };
+
+  static Frame Explore(int pc) {
+    Frame frame = {pc, -1, 0};
+    return frame;
+  }
+
+  static Frame Restore(int reg, int value) {
+    Frame frame = {-1, reg, value};
+    return frame;
+  }
+
+  void AddThread(ThreadList* list, int pc, int position, const int* registers);
+  bool CheckAssertion(int type, int position);
+
+  static bool IsConsuming(int opcode) {
+    return opcode == kNfaChar || opcode == kNfaClass || opcode == kNfaMatch;
+  }
+
+  // Which of the kNfaMark registers are equal to |position|.
+  int MarkMask(const int* registers, int position) {
+    int mask = 0;
+    for (int i = 0; i < mark_count_; i++) {
+      if (registers[capture_register_count_ + i] == position) mask |= 1 << i;
+    }
+    return mask;
+  }
+
+  bool IsWordAt(int position) {
+    return position >= 0 && position < subject_.length() &&
+           IsRegExpWord(static_cast<uc16>(subject_[position]));
+  }
+
+  bool IsNewlineAt(int position) {
+    // IsRegExpNewline is true for characters that are *not* newlines.
+    return !IsRegExpNewline(static_cast<uc16>(subject_[position]));
+  }
+
+  const int* program_;
+  Vector<const Char> subject_;
+  bool sticky_;
+  int register_count_;
+  int capture_register_count_;
+  int thread_count_;
+  int mark_count_;
+  // The stamp of the position at which an instruction was last reached, for
+  // each combination of kNfaMark registers equal to the position. The stamp
+  // of a position is the position plus |stamp_offset_|.
+  int* marks_;
+  int stamp_offset_;
+  ScopedVector<int> scratch_;
+  List<Frame> stack_;
+};
+
+
+template <typename Char>
+bool NfaMatcher<Char>::CheckAssertion(int type, int position) {
+  switch (type) {
+    case RegExpAssertion::START_OF_INPUT:
+      return position == 0;
+    case RegExpAssertion::END_OF_INPUT:
+      return position == subject_.length();
+    case RegExpAssertion::START_OF_LINE:
+      return position == 0 || IsNewlineAt(position - 1);
+    case RegExpAssertion::END_OF_LINE:
+      return position == subject_.length() || IsNewlineAt(position);
+    case RegExpAssertion::BOUNDARY:
+      return IsWordAt(position - 1) != IsWordAt(position);
+    case RegExpAssertion::NON_BOUNDARY:
+      return IsWordAt(position - 1) == IsWordAt(position);
+  }
+  UNREACHABLE();
+  return false;
+}
+
+
+// Follows the instructions that do not consume characters from |pc| and adds
+// a thread to |list| for each consuming instruction reached.
+template <typename Char>
+void NfaMatcher<Char>::AddThread(ThreadList* list, int pc, int position,
+                                 const int* registers) {
+  int* scratch = scratch_.start();
+  MemCopy(scratch, registers, register_count_ * sizeof(int));
+  stack_.Rewind(0);
+  stack_.Add(Explore(pc));
+  while (!stack_.is_empty()) {
+    Frame frame = stack_.RemoveLast();
+    if (frame.restore_register >= 0) {
+      scratch[frame.restore_register] = frame.restore_value;
+      continue;
+    }
+    pc = frame.pc;
+    while (true) {
+      const int* insn = &program_[pc];
+      int key = pc << mark_count_;
+      if (!IsConsuming(insn[0])) key |= MarkMask(scratch, position);
+      int stamp = position + stamp_offset_;
+      if (marks_[key] == stamp) break;
+      marks_[key] = stamp;
+      switch (insn[0]) {
+        case kNfaSplit:
+          stack_.Add(Explore(insn[2]));
+          pc = insn[1];
+          continue;
+        case kNfaJump:
+          pc = insn[1];
+          continue;
+        case kNfaSave:
+        case kNfaMark:
+          stack_.Add(Restore(insn[1], scratch[insn[1]]));
+          scratch[insn[1]] = position;
+          pc += 2;
+          continue;
+        case kNfaClear:
+          for (int reg = insn[1]; reg <= insn[2]; reg++) {
+            stack_.Add(Restore(reg, scratch[reg]));
+            scratch[reg] = -1;
+          }
+          pc += 3;
+          continue;
+        case kNfaCheckProgress:
+          if (scratch[insn[1]] == position) break;
+          pc += 2;
+          continue;
+        case kNfaAssert:
+          if (!CheckAssertion(insn[1], position)) break;
+          pc += 2;
+          continue;
+        default:
+          list->Add(pc, scratch);
+          break;
+      }
+      break;
+    }
+  }
+}
+
+
+template <typename Char>
+bool NfaMatcher<Char>::Match(int index, int32_t* output) {
+  ThreadList first(thread_count_, register_count_);
+  ThreadList second(thread_count_, register_count_);
+  ThreadList* current = &first;
+  ThreadList* next = &second;
+  ScopedVector<int> initial_registers(register_count_);
+  for (int i = 0; i < register_count_; i++) initial_registers[i] = -1;
+
+  bool matched = false;
+  int length = subject_.length();
+  for (int position = index;; position++) {
+    // A new search starting here has the lowest priority.
+    if (!matched && (!sticky_ || position == index)) {
+      AddThread(current, kNfaHeaderLength, position,
+                initial_registers.start());
+    }
+    if (current->length() == 0) {
+      if (matched || sticky_ || position == length) break;
+      continue;
+    }
+    next->Clear();
+    Char c = position < length ? subject_[position] : 0;
+    for (int i = 0; i < current->length(); i++) {
+      int pc = current->pc(i);
+      const int* insn = &program_[pc];
+      if (insn[0] == kNfaMatch) {
+        MemCopy(output, current->registers(i),
+                capture_register_count_ * sizeof(int32_t));
+        matched = true;
+        // Threads with lower priority cannot produce a preferred match.
+        break;
+      }
+      if (position == length) continue;
+      bool consumed;
+      if (insn[0] == kNfaChar) {
+        consumed = c == insn[1];
+        pc += 2;
+      } else {
+        DCHECK_EQ(kNfaClass, insn[0]);
+        consumed = false;
+        int range_count = insn[1];
+        for (int r = 0; r < range_count; r++) {
+          if (c < insn[2 + 2 * r]) break;
+          if (c <= insn[3 + 2 * r]) {
+            consumed = true;
+            break;
+          }
+        }
+        pc += 2 + 2 * range_count;
+      }
+      if (consumed) {
+        AddThread(next, pc, position + 1, current->registers(i));
+      }
+    }
+    if (position == length) break;
+    std::swap(current, next);
+  }
+  return matched;
+}
+
+
+int RegExpNfaMarks::Reserve(int length, int positions) {
+  if (length > length_ || next_stamp_ > kMaxInt - positions) {
+    if (length > length_) {
+      DeleteArray(marks_);
+      marks_ = NewArray<int>(length);
+      length_ = length;
+    }
+    for (int i = 0; i < length_; i++) marks_[i] = -1;
+    next_stamp_ = 0;
+  }
+  int first_stamp = next_stamp_;
+  next_stamp_ += positions;
+  return first_stamp;
+}
+
+
+RegExpImpl::IrregexpResult RegExpNfa::Match(Isolate* isolate,
+                                            Handle<ByteArray> program,
+                                            Handle<String> subject,
+                                            int index, int32_t* output,
+                                            int output_size) {
+  DCHECK(subject->IsFlat());
+  DisallowHeapAllocation no_gc;
+  const int* code =
+      reinterpret_cast<const int*>(program->GetDataStartAddress());
+  int program_length = program->length() / kIntSize;
+  DCHECK_GE(output_size, code[kNfaCaptureRegisterCountIndex]);
+  USE(output_size);
+  // The match visits the positions from |index| to the end of the subject.
+  int mark_count =
+      code[kNfaRegisterCountIndex] - code[kNfaCaptureRegisterCountIndex];
+  RegExpNfaMarks* marks = isolate->regexp_nfa_marks();
+  int first_stamp = marks->Reserve(program_length << mark_count,
+                                   subject->length() - index + 1);
+  int stamp_offset = first_stamp - index;
+  String::FlatContent content = subject->GetFlatContent();
+  bool matched;
+  if (content.IsOneByte()) {
+    NfaMatcher<uint8_t> matcher(code, marks->marks(), stamp_offset,
+                                content.ToOneByteVector());
+    matched = matcher.Match(index, output);
+  } else {
+    NfaMatcher<uc16> matcher(code, marks->marks(), stamp_offset,
+                             content.ToUC16Vector());
+    matched = matcher.Match(index, output);
+  }
+  return matched ? RegExpImpl::RE_SUCCESS : RegExpImpl::RE_FAILURE;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,80 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_NFA_H_
+#define V8_REGEXP_REGEXP_NFA_H_
+
+#include "src/regexp/jsregexp.h"
+
+namespace v8 {
+namespace internal {
+
+// A regexp engine that simulates a Thompson NFA over the subject instead of
+// backtracking, so that the time to match is linear in the length of the
+// subject for a given pattern. Threads are kept in priority order, which
+// gives the same leftmost match and captures as the backtracking engines.
+//
+// Only patterns without backreferences and lookarounds can be expressed as
+// an NFA. Regexps are compiled to a program that is stored in a ByteArray in
+// the code slots of a JSRegExp of type LINEAR.
+class RegExpNfa : public AllStatic {
+ public:
+  // Compiles |tree| into a program. Returns an empty handle if the pattern
+  // uses features the NFA engine does not support or the program would be
+  // too large.
+  static MaybeHandle<ByteArray> Compile(Isolate* isolate, Zone* zone,
+                                        RegExpTree* tree,
+                                        JSRegExp::Flags flags,
+                                        int capture_count);
+
+  // Whether |tree| contains an unbounded quantifier nested in another
+  // unbounded quantifier, like /(a+)+b/, on which backtracking engines take
+  // time exponential in the length of the subject when matching fails.
+  static bool IsProneToBacktracking(RegExpTree* tree);
+
+  // Searches |subject| for a match of |program|, starting at |index|. On a
+  // match the capture registers are stored to |output| and RE_SUCCESS is
+  // returned, otherwise |output| is left untouched. The subject must be
+  // flat.
+  static RegExpImpl::IrregexpResult Match(Isolate* isolate,
+                                          Handle<ByteArray> program,
+                                          Handle<String> subject,
+                                          int index, int32_t* output,
+                                          int output_size);
+
+  // Upper bound on the number of words in a program. Patterns with large
+  // counted repetitions are left to the backtracking engines.
+  static const int kMaxProgramLength = 16 * KB;
+};
+
+
+// The per-isolate table in which the NFA engine records the position at
+// which an instruction was last reached. It is kept between matches, so that
+// global searches, which match once per result, do not allocate and clear it
+// every time. Instead of positions, entries hold stamps that keep growing
+// across matches, so entries from earlier matches never compare equal.
+class RegExpNfaMarks {
+ public:
+  RegExpNfaMarks() : marks_(NULL), length_(0), next_stamp_(0) {}
+  ~RegExpNfaMarks() { DeleteArray(marks_); }
+
+  // Prepares the table for a match that needs |length| entries and visits
+  // |positions| subject positions. Returns the stamp of the first position;
+  // the following positions use consecutive stamps.
+  int Reserve(int length, int positions);
+
+  int* marks() { return marks_; }
+
+ private:
+  int* marks_;
+  int length_;
+  int next_stamp_;
+
+  DISALLOW_COPY_AND_ASSIGN(RegExpNfaMarks);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_NFA_H_
@@ -1297,20 +1297,54 @@ void RegExpMacroAssemblerS390::CallCFunctionUsingStub(
 
 
 bool RegExpMacroAssemblerS390::CanReadUnaligned() {
-  return CpuFeatures::IsSupported(UNALIGNED_ACCESSES) && !slow_safe();
+  // z/Architecture allows unaligned operands for all loads used below.
+  return !slow_safe();
 }
 
 
 void RegExpMacroAssemblerS390::LoadCurrentCharacterUnchecked(int cp_offset,
                                                             int characters) {
-  DCHECK(characters == 1);
+  MemOperand location(current_input_offset(), end_of_input_address(),
+                      cp_offset * char_size());
+  // Irregexp expects the first character in the least significant bits, so
+  // multiple characters are loaded byte-reversed on big-endian targets.
   if (mode_ == LATIN1) {
-    __ LoadlB(current_character(), MemOperand(current_input_offset(),
-                  end_of_input_address(), cp_offset * char_size()));
+    if (characters == 4) {
+#if V8_TARGET_BIG_ENDIAN
+      __ lrv(current_character(), location);
+#if V8_TARGET_ARCH_S390X
+      __ llgfr(current_character(), current_character());
+#endif
+#else
+      __ LoadlW(current_character(), location);
+#endif
+    } else if (characters == 2) {
+#if V8_TARGET_BIG_ENDIAN
+      __ lrvh(current_character(), location);
+#if V8_TARGET_ARCH_S390X
+      __ llghr(current_character(), current_character());
+#else
+      __ llhr(current_character(), current_character());
+#endif
+#else
+      __ LoadLogicalHalfWordP(current_character(), location);
+#endif
+    } else {
+      DCHECK(characters == 1);
+      __ LoadlB(current_character(), location);
+    }
   } else {
     DCHECK(mode_ == UC16);
-    __ LoadLogicalHalfWordP(current_character(), MemOperand(
-      current_input_offset(), end_of_input_address(), cp_offset * char_size()));
+    if (characters == 2) {
+      __ LoadlW(current_character(), location);
+#if V8_TARGET_BIG_ENDIAN
+      // Swap the halfwords rather than the bytes.
+      __ rll(current_character(), current_character(), Operand(16));
+#endif
+    } else {
+      DCHECK(characters == 1);
+      __ LoadLogicalHalfWordP(current_character(), location);
+    }
   }
 }
 
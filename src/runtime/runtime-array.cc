@@ -500,5 +500,126 @@ RUNTIME_FUNCTION(Runtime_ArraySpeciesConstructor) {
   return *constructor;
 }
 
+
+namespace {
+
+// Returns the index of the first element of {elements} in [from, to) that is
+// strictly equal (or SameValueZero if {same_value_zero}) to {value}, or -1.
+// Holes are skipped unless {hole_matches}, in which case they are reported
+// as matches; they never need to be inspected for packed elements kinds.
+int SearchFastObjectElements(FixedArray* elements, bool holey, Object* value,
+                             bool same_value_zero, bool hole_matches, int from,
+                             int to) {
+  DisallowHeapAllocation no_gc;
+  Object* the_hole = elements->GetHeap()->the_hole_value();
+  if (value->IsNumber() || value->IsString() || value->IsSimd128Value()) {
+    if (value->IsSmi()) {
+      // Strict equality and SameValueZero agree on everything but NaN.
+      for (int i = from; i < to; i++) {
+        Object* element = elements->get(i);
+        if (element == value) return i;
+        if (element->IsHeapNumber() && value->StrictEquals(element)) return i;
+      }
+      return -1;
+    }
+    for (int i = from; i < to; i++) {
+      Object* element = elements->get(i);
+      if (same_value_zero ? value->SameValueZero(element)
+                          : value->StrictEquals(element)) {
+        return i;
+      }
+    }
+    return -1;
+  }
+  for (int i = from; i < to; i++) {
+    Object* element = elements->get(i);
+    if (element == value) return i;
+    if (holey && hole_matches && element == the_hole) return i;
+  }
+  return -1;
+}
+
+
+int SearchFastDoubleElements(FixedDoubleArray* elements, bool holey,
+                             Object* value, bool same_value_zero,
+                             bool hole_matches, int from, int to) {
+  DisallowHeapAllocation no_gc;
+  if (!value->IsNumber()) {
+    if (!holey || !hole_matches) return -1;
+    for (int i = from; i < to; i++) {
+      if (elements->is_the_hole(i)) return i;
+    }
+    return -1;
+  }
+  double search = value->Number();
+  if (std::isnan(search)) {
+    if (!same_value_zero) return -1;
+    for (int i = from; i < to; i++) {
+      if (holey && elements->is_the_hole(i)) continue;
+      if (std::isnan(elements->get_scalar(i))) return i;
+    }
+    return -1;
+  }
+  for (int i = from; i < to; i++) {
+    if (holey && elements->is_the_hole(i)) continue;
+    if (elements->get_scalar(i) == search) return i;
+  }
+  return -1;
+}
+
+}  // namespace
+
+
+// Searches the backing store of a JSArray with fast elements directly, for
+// Array.prototype.indexOf (strict equality) and Array.prototype.includes
+// (SameValueZero). Returns the index of the first match or -1, or undefined
+// if the array cannot be searched without looking at its prototypes.
+RUNTIME_FUNCTION(Runtime_ArraySearchFastElements) {
+  SealHandleScope shs(isolate);
+  DCHECK(args.length() == 5);
+  CONVERT_ARG_CHECKED(JSArray, array, 0);
+  CONVERT_ARG_CHECKED(Object, value, 1);
+  CONVERT_ARG_CHECKED(Object, from_obj, 2);
+  CONVERT_ARG_CHECKED(Object, length_obj, 3);
+  CONVERT_BOOLEAN_ARG_CHECKED(same_value_zero, 4);
+  Object* undefined = isolate->heap()->undefined_value();
+  if (!from_obj->IsSmi() || !length_obj->IsSmi()) return undefined;
+  int from = Smi::cast(from_obj)->value();
+  int length = Smi::cast(length_obj)->value();
+  ElementsKind kind = array->GetElementsKind();
+  if (!IsFastElementsKind(kind)) return undefined;
+  // The array may have been shrunk by the conversion of the start index.
+  if (!array->length()->IsSmi() ||
+      Smi::cast(array->length())->value() < length) {
+    return undefined;
+  }
+  bool holey = IsFastHoleyElementsKind(kind);
+  if (holey) {
+    // Holes read through to the prototypes, which must not have elements.
+    Object* prototype = array->map()->prototype();
+    if (!prototype->IsJSArray() ||
+        !isolate->is_initial_array_prototype(JSArray::cast(prototype)) ||
+        !isolate->IsFastArrayConstructorPrototypeChainIntact()) {
+      return undefined;
+    }
+  }
+  if (from < 0) from = 0;
+  if (from >= length) return Smi::FromInt(-1);
+  DCHECK_LE(length, array->elements()->length());
+  // Holes read as undefined, but indexOf only considers present elements.
+  bool hole_matches = same_value_zero && value->IsUndefined();
+  int index;
+  if (IsFastDoubleElementsKind(kind)) {
+    index = SearchFastDoubleElements(FixedDoubleArray::cast(array->elements()),
+                                     holey, value, same_value_zero,
+                                     hole_matches, from, length);
+  } else {
+    index = SearchFastObjectElements(FixedArray::cast(array->elements()),
+                                     holey, value, same_value_zero,
+                                     hole_matches, from, length);
+  }
+  return Smi::FromInt(index);
+}
+
 }  // namespace internal
 }  // namespace v8
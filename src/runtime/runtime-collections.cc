@@ -31,8 +31,12 @@ RUNTIME_FUNCTION(Runtime_JSCollectionGetTable) {
   SealHandleScope shs(isolate);
   DCHECK(args.length() == 1);
   CONVERT_ARG_CHECKED(JSObject, object, 0);
-  RUNTIME_ASSERT(object->IsJSSet() || object->IsJSMap());
-  return static_cast<JSCollection*>(object)->table();
+  RUNTIME_ASSERT(object->IsJSSet() || object->IsJSMap() ||
+                 object->IsJSWeakCollection());
+  STATIC_ASSERT(JSCollection::kTableOffset == JSWeakCollection::kTableOffset);
+  return object->IsJSWeakCollection()
+             ? static_cast<JSWeakCollection*>(object)->table()
+             : static_cast<JSCollection*>(object)->table();
 }
 
 
@@ -8,12 +8,38 @@
 #include "src/factory.h"
 #include "src/isolate-inl.h"
 #include "src/objects-inl.h"
+#include "src/prototype.h"
 
 namespace v8 {
 namespace internal {
 
 namespace {
 
+// Returns true if the keys that a for-in enumerates on {receiver} depend only
+// on the maps of {receiver} and its prototypes, so that they can be cached for
+// the receiver map and guarded by its prototype chain validity cell.
+bool HasCacheableForInKeys(JSReceiver* receiver) {
+  if (!FLAG_eliminate_prototype_chain_checks) return false;
+  for (PrototypeIterator iter(receiver->GetIsolate(), receiver,
+                              PrototypeIterator::START_AT_RECEIVER);
+       !iter.IsAtEnd(); iter.Advance()) {
+    if (!iter.GetCurrent()->IsJSObject()) return false;
+    JSObject* current = iter.GetCurrent<JSObject>();
+    Map* map = current->map();
+    if (map->is_dictionary_map()) return false;
+    if (map->is_access_check_needed()) return false;
+    if (map->has_named_interceptor()) return false;
+    if (map->has_indexed_interceptor()) return false;
+    // String wrappers enumerate the characters of their string.
+    if (current->IsJSValue()) return false;
+    // Elements can be added without changing the map.
+    if (!current->HasFastElements()) return false;
+    if (current->elements()->length() != 0) return false;
+  }
+  return true;
+}
+
+
 // Returns either a FixedArray or, if the given {receiver} has an enum cache
 // that contains all enumerable properties of the {receiver} and its prototypes
 // have none, the map of the {receiver}. This is used to speed up the check for
@@ -22,13 +48,34 @@ MaybeHandle<HeapObject> Enumerate(Handle<JSReceiver> receiver) {
   Isolate* const isolate = receiver->GetIsolate();
   // Test if we have an enum cache for {receiver}.
   if (!receiver->IsSimpleEnum()) {
+    // Otherwise reuse the keys of an earlier for-in over a receiver with the
+    // same map, unless the prototype chain has changed since.
+    bool cacheable = HasCacheableForInKeys(*receiver);
+    if (cacheable) {
+      FixedArray* cached_keys =
+          isolate->for_in_cache()->Lookup(receiver->map());
+      if (cached_keys != NULL) return handle(cached_keys, isolate);
+    }
     Handle<FixedArray> keys;
     ASSIGN_RETURN_ON_EXCEPTION(
         isolate, keys,
         JSReceiver::GetKeys(receiver, INCLUDE_PROTOS, ENUMERABLE_STRINGS),
         HeapObject);
     // Test again, since cache may have been built by GetKeys() calls above.
-    if (!receiver->IsSimpleEnum()) return keys;
+    if (receiver->IsSimpleEnum()) return handle(receiver->map(), isolate);
+    if (cacheable && HasCacheableForInKeys(*receiver)) {
+      Handle<Map> map(receiver->map(), isolate);
+      Handle<Cell> validity_cell =
+          Map::GetOrCreatePrototypeChainValidityCell(map, isolate);
+      if (!validity_cell.is_null()) {
+        // The cache holds raw pointers, so the keys must not move during
+        // scavenges.
+        keys = isolate->factory()->CopyFixedArrayUpTo(keys, keys->length(),
+                                                      TENURED);
+        isolate->for_in_cache()->Update(*map, *validity_cell, *keys);
+      }
+    }
+    return keys;
   }
   return handle(receiver->map(), isolate);
 }
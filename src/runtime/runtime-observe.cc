@@ -45,6 +45,19 @@ RUNTIME_FUNCTION(Runtime_EnqueueMicrotask) {
 }
 
 
+RUNTIME_FUNCTION(Runtime_EnqueuePromiseReactionJob) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 2);
+  CONVERT_ARG_HANDLE_CHECKED(Object, value, 0);
+  CONVERT_ARG_HANDLE_CHECKED(JSArray, tasks, 1);
+  Handle<Context> native_context(isolate->context()->native_context(), isolate);
+  isolate->EnqueueMicrotask(
+      isolate->factory()->NewPromiseReactionJobInfo(value, tasks,
+                                                    native_context));
+  return isolate->heap()->undefined_value();
+}
+
+
 RUNTIME_FUNCTION(Runtime_RunMicrotasks) {
   HandleScope scope(isolate);
   DCHECK(args.length() == 0);
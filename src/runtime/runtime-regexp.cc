@@ -768,6 +768,95 @@ RUNTIME_FUNCTION(Runtime_StringSplit) {
 }
 
 
+// Splits |subject| at the matches of a non-sticky regexp, see RegExpSplit in
+// regexp.js. The matches are streamed out of a GlobalCache instead of
+// creating a match info array for each of them.
+RUNTIME_FUNCTION(Runtime_RegExpSplit) {
+  HandleScope handle_scope(isolate);
+  DCHECK(args.length() == 4);
+  CONVERT_ARG_HANDLE_CHECKED(JSRegExp, regexp, 0);
+  CONVERT_ARG_HANDLE_CHECKED(String, subject, 1);
+  CONVERT_NUMBER_CHECKED(uint32_t, limit, Uint32, args[2]);
+  CONVERT_ARG_HANDLE_CHECKED(JSArray, last_match_info, 3);
+  RUNTIME_ASSERT(limit > 0);
+  RUNTIME_ASSERT(subject->length() > 0);
+  RUNTIME_ASSERT((regexp->GetFlags() & JSRegExp::kSticky) == 0);
+  RUNTIME_ASSERT(last_match_info->HasFastObjectElements());
+
+  subject = String::Flatten(subject);
+  int subject_length = subject->length();
+  int capture_count = regexp->CaptureCount();
+  int capture_registers = (capture_count + 1) * 2;
+
+  RegExpImpl::GlobalCache global_cache(regexp, subject, isolate);
+  if (global_cache.HasException()) return isolate->heap()->exception();
+
+  ZoneScope zone_scope(isolate->runtime_zone());
+  // The start and end of each part, or -1 for captures that did not
+  // participate in the match.
+  ZoneList<int> parts(16, zone_scope.zone());
+  ScopedVector<int32_t> last_match(capture_registers);
+  bool has_last_match = false;
+  bool limit_reached = false;
+  int current_index = 0;
+  int search_index = 0;
+
+  while (!limit_reached && search_index < subject_length) {
+    int32_t* match = global_cache.FetchNext();
+    if (match == NULL) break;
+    MemCopy(last_match.start(), match, capture_registers * sizeof(int32_t));
+    has_last_match = true;
+    int match_start = match[0];
+    int match_end = match[1];
+    if (match_start == subject_length) break;
+    if (match_start == match_end) {
+      search_index = global_cache.AdvanceZeroLength(match_end);
+      // A zero-length match at the start of the part is ignored.
+      if (match_end == current_index) continue;
+    } else {
+      search_index = match_end;
+    }
+    for (int i = 0; i < capture_registers && !limit_reached; i += 2) {
+      if (i == 0) {
+        parts.Add(current_index, zone_scope.zone());
+        parts.Add(match_start, zone_scope.zone());
+      } else {
+        parts.Add(match[i], zone_scope.zone());
+        parts.Add(match[i + 1], zone_scope.zone());
+      }
+      limit_reached = static_cast<uint32_t>(parts.length() / 2) == limit;
+    }
+    current_index = match_end;
+  }
+  if (global_cache.HasException()) return isolate->heap()->exception();
+
+  if (!limit_reached) {
+    parts.Add(current_index, zone_scope.zone());
+    parts.Add(subject_length, zone_scope.zone());
+  }
+
+  int part_count = parts.length() / 2;
+  Handle<FixedArray> elements = isolate->factory()->NewFixedArray(part_count);
+  for (int i = 0; i < part_count; i++) {
+    HandleScope local_loop_handle(isolate);
+    int start = parts[i * 2];
+    if (start < 0) {
+      elements->set(i, isolate->heap()->undefined_value());
+    } else {
+      Handle<String> substring =
+          isolate->factory()->NewSubString(subject, start, parts[i * 2 + 1]);
+      elements->set(i, *substring);
+    }
+  }
+
+  if (has_last_match) {
+    RegExpImpl::SetLastMatchInfo(last_match_info, subject, capture_count,
+                                 last_match.start());
+  }
+  return *isolate->factory()->NewJSArrayWithElements(elements);
+}
+
+
 RUNTIME_FUNCTION(Runtime_RegExpExec) {
   HandleScope scope(isolate);
   DCHECK(args.length() == 4);
@@ -921,12 +1010,12 @@ static Object* SearchRegExpMultiple(Isolate* isolate, Handle<String> subject,
       }
 
       if (has_capture) {
-        // Arguments array to replace function is match, captures, index and
-        // subject, i.e., 3 + capture count in total.
-        Handle<FixedArray> elements =
-            isolate->factory()->NewFixedArray(3 + capture_count);
-
-        elements->set(0, *match);
+        // The arguments to the replace function are the match, captures,
+        // index and subject, i.e., 3 + capture count in total. They are
+        // added to the result in place so that no array is allocated for
+        // each match.
+        builder.EnsureCapacity(3 + capture_count);
+        builder.Add(*match);
         for (int i = 1; i <= capture_count; i++) {
           int start = current_match[i * 2];
           if (start >= 0) {
@@ -934,15 +1023,14 @@ static Object* SearchRegExpMultiple(Isolate* isolate, Handle<String> subject,
             DCHECK(start <= end);
             Handle<String> substring =
                 isolate->factory()->NewSubString(subject, start, end);
-            elements->set(i, *substring);
+            builder.Add(*substring);
           } else {
             DCHECK(current_match[i * 2 + 1] < 0);
-            elements->set(i, isolate->heap()->undefined_value());
+            builder.Add(isolate->heap()->undefined_value());
           }
         }
-        elements->set(capture_count + 1, Smi::FromInt(match_start));
-        elements->set(capture_count + 2, *subject);
-        builder.Add(*isolate->factory()->NewJSArrayWithElements(elements));
+        builder.Add(Smi::FromInt(match_start));
+        builder.Add(*subject);
       } else {
         builder.Add(*match);
       }
@@ -954,6 +1042,7 @@ static Object* SearchRegExpMultiple(Isolate* isolate, Handle<String> subject,
   if (match_start >= 0) {
     // Finished matching, with at least one match.
     if (match_end < subject_length) {
+      builder.EnsureCapacity(2);
       ReplacementStringBuilder::AddSubjectSlice(&builder, match_end,
                                                 subject_length);
     }
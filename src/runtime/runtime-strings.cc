@@ -30,9 +30,25 @@ int StringMatch(Isolate* isolate, Handle<String> sub, Handle<String> pat,
   int subject_length = sub->length();
   if (start_index + pattern_length > subject_length) return -1;
 
-  sub = String::Flatten(sub);
   pat = String::Flatten(pat);
 
+  // A rope is searched in place when searching from its start. A search from
+  // a later index is likely one of a series over all matches, so the rope is
+  // flattened once instead of walking its leaves on every call.
+  if (start_index == 0 && !sub->IsFlat()) {
+    DisallowHeapAllocation no_gc;  // ensure vectors stay valid
+    String::FlatContent seq_pat = pat->GetFlatContent();
+    if (seq_pat.IsOneByte()) {
+      SegmentedStringSearch<uint8_t> search(isolate,
+                                            seq_pat.ToOneByteVector());
+      return search.Search(*sub, start_index);
+    }
+    SegmentedStringSearch<uc16> search(isolate, seq_pat.ToUC16Vector());
+    return search.Search(*sub, start_index);
+  }
+
+  sub = String::Flatten(sub);
+
   DisallowHeapAllocation no_gc;  // ensure vectors stay valid
   // Extract flattened substrings of cons strings before getting encoding.
   String::FlatContent seq_sub = sub->GetFlatContent();
@@ -51,7 +51,8 @@ namespace internal {
   F(GetCachedArrayIndex, 1, 1)       \
   F(FixedArrayGet, 2, 1)             \
   F(FixedArraySet, 3, 1)             \
-  F(ArraySpeciesConstructor, 1, 1)
+  F(ArraySpeciesConstructor, 1, 1)   \
+  F(ArraySearchFastElements, 5, 1)
 
 
 #define FOR_EACH_INTRINSIC_ATOMICS(F) \
@@ -477,6 +478,7 @@ namespace internal {
   F(IsObserved, 1, 1)                            \
   F(SetIsObserved, 1, 1)                         \
   F(EnqueueMicrotask, 1, 1)                      \
+  F(EnqueuePromiseReactionJob, 2, 1)             \
   F(RunMicrotasks, 0, 1)                         \
   F(DeliverObservationChangeRecords, 2, 1)       \
   F(GetObservationState, 0, 1)                   \
@@ -510,6 +512,7 @@ namespace internal {
 #define FOR_EACH_INTRINSIC_REGEXP(F)           \
   F(StringReplaceGlobalRegExpWithString, 4, 1) \
   F(StringSplit, 3, 1)                         \
+  F(RegExpSplit, 4, 1)                         \
   F(RegExpExec, 4, 1)                          \
   F(RegExpFlags, 1, 1)                         \
   F(RegExpSource, 1, 1)                        \
@@ -611,20 +611,29 @@ MaybeHandle<Object> Deserializer::DeserializePartial(
 
 MaybeHandle<SharedFunctionInfo> Deserializer::DeserializeCode(
     Isolate* isolate) {
+  Handle<HeapObject> result;
+  if (!DeserializeUserObject(isolate).ToHandle(&result)) {
+    return Handle<SharedFunctionInfo>();
+  }
+  return Handle<SharedFunctionInfo>::cast(result);
+}
+
+
+MaybeHandle<HeapObject> Deserializer::DeserializeUserObject(Isolate* isolate) {
   Initialize(isolate);
   if (!ReserveSpace()) {
-    return Handle<SharedFunctionInfo>();
+    return Handle<HeapObject>();
   } else {
     deserializing_user_code_ = true;
     HandleScope scope(isolate);
-    Handle<SharedFunctionInfo> result;
+    Handle<HeapObject> result;
     {
       DisallowHeapAllocation no_gc;
       Object* root;
       VisitPointer(&root);
       DeserializeDeferredObjects();
       FlushICacheForNewCodeObjects();
-      result = Handle<SharedFunctionInfo>(SharedFunctionInfo::cast(root));
+      result = Handle<HeapObject>(HeapObject::cast(root));
     }
     CommitPostProcessedObjects(isolate);
     return scope.CloseAndEscape(result);
@@ -766,7 +775,7 @@ HeapObject* Deserializer::PostProcessNewObject(HeapObject* obj, int space) {
 
 
 void Deserializer::CommitPostProcessedObjects(Isolate* isolate) {
-  StringTable::EnsureCapacityForDeserialization(
+  StringTable::EnsureCapacityForBulkInsert(
       isolate, new_internalized_strings_.length());
   for (Handle<String> string : new_internalized_strings_) {
     StringTableInsertionKey key(*string);
@@ -2452,9 +2461,11 @@ void CodeSerializer::SerializeObject(HeapObject* obj, HowToCode how_to_code,
     switch (code_object->kind()) {
       case Code::OPTIMIZED_FUNCTION:  // No optimized code compiled yet.
       case Code::HANDLER:             // No handlers patched in yet.
-      case Code::REGEXP:              // No regexp literals initialized yet.
       case Code::NUMBER_OF_KINDS:     // Pseudo enum value.
         CHECK(false);
+      case Code::REGEXP:  // Only reachable from regexp data.
+        SerializeGeneric(code_object, how_to_code, where_to_point);
+        return;
       case Code::BUILTIN:
         SerializeBuiltin(code_object->builtin_index(), how_to_code,
                          where_to_point);
@@ -2603,6 +2614,75 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
     return MaybeHandle<SharedFunctionInfo>();
   }
 
+  Handle<SharedFunctionInfo> result;
+  if (!DeserializeChecked(isolate, scd.get(), source).ToHandle(&result)) {
+    return MaybeHandle<SharedFunctionInfo>();
+  }
+
+  if (FLAG_profile_deserialization) {
+    double ms = timer.Elapsed().InMillisecondsF();
+    int length = cached_data->length();
+    PrintF("[Deserializing from %d bytes took %0.3f ms]\n", length, ms);
+  }
+  return scope.CloseAndEscape(result);
+}
+
+
+MaybeHandle<SharedFunctionInfo> CodeSerializer::DeserializePrepared(
+    Isolate* isolate, ScriptData* cached_data, SerializedCodeData* scd,
+    Handle<String> source) {
+  base::ElapsedTimer timer;
+  if (FLAG_profile_deserialization) timer.Start();
+
+  HandleScope scope(isolate);
+
+  if (!scd->MatchesSource(*source)) {
+    if (FLAG_profile_deserialization) PrintF("[Cached code failed check]\n");
+    cached_data->Reject();
+    return MaybeHandle<SharedFunctionInfo>();
+  }
+
+  Handle<SharedFunctionInfo> result;
+  if (!DeserializeChecked(isolate, scd, source).ToHandle(&result)) {
+    return MaybeHandle<SharedFunctionInfo>();
+  }
+
+  if (FLAG_profile_deserialization) {
+    double ms = timer.Elapsed().InMillisecondsF();
+    int length = cached_data->length();
+    PrintF("[Deserializing prepared data of %d bytes took %0.3f ms]\n", length,
+           ms);
+  }
+  return scope.CloseAndEscape(result);
+}
+
+
+MaybeHandle<SharedFunctionInfo> CodeSerializer::DeserializeChecked(
+    Isolate* isolate, SerializedCodeData* scd, Handle<String> source) {
+  Handle<HeapObject> root;
+  if (!DeserializeRoot(isolate, scd, source).ToHandle(&root)) {
+    return MaybeHandle<SharedFunctionInfo>();
+  }
+  Handle<SharedFunctionInfo> result = Handle<SharedFunctionInfo>::cast(root);
+
+  result->set_deserialized(true);
+
+  if (isolate->logger()->is_logging_code_events() ||
+      isolate->cpu_profiler()->is_profiling()) {
+    String* name = isolate->heap()->empty_string();
+    if (result->script()->IsScript()) {
+      Script* script = Script::cast(result->script());
+      if (script->name()->IsString()) name = String::cast(script->name());
+    }
+    isolate->logger()->CodeCreateEvent(Logger::SCRIPT_TAG, result->code(),
+                                       *result, NULL, name);
+  }
+  return result;
+}
+
+
+MaybeHandle<HeapObject> CodeSerializer::DeserializeRoot(
+    Isolate* isolate, SerializedCodeData* scd, Handle<String> source) {
   // Prepare and register list of attached objects.
   Vector<const uint32_t> code_stub_keys = scd->CodeStubKeys();
   Vector<Handle<Object> > attached_objects = Vector<Handle<Object> >::New(
@@ -2613,33 +2693,93 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
         CodeStub::GetCode(isolate, code_stub_keys[i]).ToHandleChecked();
   }
 
-  Deserializer deserializer(scd.get());
+  Deserializer deserializer(scd);
   deserializer.SetAttachedObjects(attached_objects);
 
   // Deserialize.
-  Handle<SharedFunctionInfo> result;
-  if (!deserializer.DeserializeCode(isolate).ToHandle(&result)) {
+  Handle<HeapObject> result;
+  if (!deserializer.DeserializeUserObject(isolate).ToHandle(&result)) {
     // Deserializing may fail if the reservations cannot be fulfilled.
     if (FLAG_profile_deserialization) PrintF("[Deserializing failed]\n");
-    return MaybeHandle<SharedFunctionInfo>();
+    return MaybeHandle<HeapObject>();
+  }
+  return result;
+}
+
+
+ScriptData* CodeSerializer::SerializeRegExpData(Isolate* isolate,
+                                                Handle<FixedArray> data,
+                                                Handle<String> source) {
+  DCHECK_EQ(JSRegExp::IRREGEXP,
+            Smi::cast(data->get(JSRegExp::kTagIndex))->value());
+  base::ElapsedTimer timer;
+  if (FLAG_profile_deserialization) timer.Start();
+  if (FLAG_trace_serializer) {
+    PrintF("[Serializing regexp /");
+    source->ShortPrint();
+    PrintF("/]\n");
   }
 
+  int code_size = 0;
+  for (int i = 0; i < 2; i++) {
+    Object* code = data->get(JSRegExp::code_index(i == 0));
+    if (code->IsHeapObject()) code_size += HeapObject::cast(code)->Size();
+  }
+  SnapshotByteSink sink(code_size * 2 + data->Size());
+  CodeSerializer cs(isolate, &sink, *source);
+  DisallowHeapAllocation no_gc;
+  Object** location = Handle<Object>::cast(data).location();
+  cs.VisitPointer(location);
+  cs.SerializeDeferredObjects();
+  cs.Pad();
+
+  SerializedCodeData serialized(sink.data(), cs);
+  ScriptData* script_data = serialized.GetScriptData();
+
   if (FLAG_profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
-    int length = cached_data->length();
-    PrintF("[Deserializing from %d bytes took %0.3f ms]\n", length, ms);
+    int length = script_data->length();
+    PrintF("[Serializing regexp to %d bytes took %0.3f ms]\n", length, ms);
   }
-  result->set_deserialized(true);
+  return script_data;
+}
+
+
+MaybeHandle<FixedArray> CodeSerializer::DeserializeRegExpData(
+    Isolate* isolate, ScriptData* cached_data, Handle<String> source) {
+  base::ElapsedTimer timer;
+  if (FLAG_profile_deserialization) timer.Start();
+
+  HandleScope scope(isolate);
+
+  base::SmartPointer<SerializedCodeData> scd(
+      SerializedCodeData::FromCachedData(isolate, cached_data, *source));
+  if (scd.is_empty()) {
+    if (FLAG_profile_deserialization) PrintF("[Cached regexp failed check]\n");
+    DCHECK(cached_data->rejected());
+    return MaybeHandle<FixedArray>();
+  }
+
+  Handle<HeapObject> root;
+  if (!DeserializeRoot(isolate, scd.get(), source).ToHandle(&root)) {
+    return MaybeHandle<FixedArray>();
+  }
+  Handle<FixedArray> result = Handle<FixedArray>::cast(root);
 
   if (isolate->logger()->is_logging_code_events() ||
       isolate->cpu_profiler()->is_profiling()) {
-    String* name = isolate->heap()->empty_string();
-    if (result->script()->IsScript()) {
-      Script* script = Script::cast(result->script());
-      if (script->name()->IsString()) name = String::cast(script->name());
+    for (int i = 0; i < 2; i++) {
+      Object* code = result->get(JSRegExp::code_index(i == 0));
+      if (code->IsCode()) {
+        isolate->logger()->RegExpCodeCreateEvent(Code::cast(code), *source);
+      }
     }
-    isolate->logger()->CodeCreateEvent(Logger::SCRIPT_TAG, result->code(),
-                                       *result, NULL, name);
+  }
+
+  if (FLAG_profile_deserialization) {
+    double ms = timer.Elapsed().InMillisecondsF();
+    int length = cached_data->length();
+    PrintF("[Deserializing regexp from %d bytes took %0.3f ms]\n", length, ms);
   }
   return scope.CloseAndEscape(result);
 }
@@ -2796,8 +2936,23 @@ SerializedCodeData::SerializedCodeData(const List<byte>& payload,
 
 SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheck(
     Isolate* isolate, String* source) const {
+  return SanityCheckImpl(ComputeMagicNumber(isolate), FlagList::Hash(),
+                         source);
+}
+
+
+SerializedCodeData::SanityCheckResult
+SerializedCodeData::SanityCheckWithoutSource(
+    uint32_t expected_magic_number, uint32_t expected_flag_hash) const {
+  return SanityCheckImpl(expected_magic_number, expected_flag_hash, NULL);
+}
+
+
+SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheckImpl(
+    uint32_t expected_magic_number, uint32_t expected_flag_hash,
+    String* source) const {
   uint32_t magic_number = GetMagicNumber();
-  if (magic_number != ComputeMagicNumber(isolate)) return MAGIC_NUMBER_MISMATCH;
+  if (magic_number != expected_magic_number) return MAGIC_NUMBER_MISMATCH;
   uint32_t version_hash = GetHeaderValue(kVersionHashOffset);
   uint32_t source_hash = GetHeaderValue(kSourceHashOffset);
   uint32_t cpu_features = GetHeaderValue(kCpuFeaturesOffset);
@@ -2805,16 +2960,26 @@ SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheck(
   uint32_t c1 = GetHeaderValue(kChecksum1Offset);
   uint32_t c2 = GetHeaderValue(kChecksum2Offset);
   if (version_hash != Version::Hash()) return VERSION_MISMATCH;
-  if (source_hash != SourceHash(source)) return SOURCE_MISMATCH;
+  if (source != NULL && source_hash != SourceHash(source)) {
+    return SOURCE_MISMATCH;
+  }
   if (cpu_features != static_cast<uint32_t>(CpuFeatures::SupportedFeatures())) {
     return CPU_FEATURES_MISMATCH;
   }
-  if (flags_hash != FlagList::Hash()) return FLAGS_MISMATCH;
+  if (flags_hash != expected_flag_hash) return FLAGS_MISMATCH;
   if (!Checksum(Payload()).Check(c1, c2)) return CHECKSUM_MISMATCH;
   return CHECK_SUCCESS;
 }
 
 
+bool SerializedCodeData::MatchesSource(String* source) const {
+  if (GetHeaderValue(kSourceHashOffset) == SourceHash(source)) return true;
+  source->GetIsolate()->counters()->code_cache_reject_reason()->AddSample(
+      SOURCE_MISMATCH);
+  return false;
+}
+
+
 uint32_t SerializedCodeData::SourceHash(String* source) const {
   return source->length();
 }
@@ -2876,5 +3041,20 @@ SerializedCodeData* SerializedCodeData::FromCachedData(Isolate* isolate,
   delete scd;
   return NULL;
 }
+
+
+SerializedCodeData* SerializedCodeData::FromCachedDataOffThread(
+    ScriptData* cached_data, uint32_t expected_magic_number,
+    uint32_t expected_flag_hash, int* rejection_reason) {
+  DisallowHeapAllocation no_gc;
+  SerializedCodeData* scd = new SerializedCodeData(cached_data);
+  SanityCheckResult r =
+      scd->SanityCheckWithoutSource(expected_magic_number, expected_flag_hash);
+  *rejection_reason = r;
+  if (r == CHECK_SUCCESS) return scd;
+  cached_data->Reject();
+  delete scd;
+  return NULL;
+}
 }  // namespace internal
 }  // namespace v8
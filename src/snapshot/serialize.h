@@ -15,6 +15,7 @@ namespace internal {
 
 class Isolate;
 class ScriptData;
+class SerializedCodeData;
 
 static const int kDeoptTableSerializeEntryCount = 64;
 
@@ -374,6 +375,10 @@ class Deserializer: public SerializerDeserializer {
   // Deserialize a shared function info. Fail gracefully.
   MaybeHandle<SharedFunctionInfo> DeserializeCode(Isolate* isolate);
 
+  // Deserialize the root object of code cache data, e.g. regexp data. Fail
+  // gracefully.
+  MaybeHandle<HeapObject> DeserializeUserObject(Isolate* isolate);
+
   // Pass a vector of externally-provided objects referenced by the snapshot.
   // The ownership to its backing store is handed over as well.
   void SetAttachedObjects(Vector<Handle<Object> > attached_objects) {
@@ -673,6 +678,21 @@ class CodeSerializer : public Serializer {
   MUST_USE_RESULT static MaybeHandle<SharedFunctionInfo> Deserialize(
       Isolate* isolate, ScriptData* cached_data, Handle<String> source);
 
+  // Deserialize data that has already passed the source-independent checks
+  // in SerializedCodeData::FromCachedDataOffThread. |scd| wraps |cached_data|.
+  MUST_USE_RESULT static MaybeHandle<SharedFunctionInfo> DeserializePrepared(
+      Isolate* isolate, ScriptData* cached_data, SerializedCodeData* scd,
+      Handle<String> source);
+
+  // Serializes the data of an irregexp regexp, see JSRegExp::data(),
+  // including its compiled code. |source| is the pattern.
+  static ScriptData* SerializeRegExpData(Isolate* isolate,
+                                         Handle<FixedArray> data,
+                                         Handle<String> source);
+
+  MUST_USE_RESULT static MaybeHandle<FixedArray> DeserializeRegExpData(
+      Isolate* isolate, ScriptData* cached_data, Handle<String> source);
+
   static const int kSourceObjectIndex = 0;
   STATIC_ASSERT(kSourceObjectReference == kSourceObjectIndex);
 
@@ -686,6 +706,12 @@ class CodeSerializer : public Serializer {
   const List<uint32_t>* stub_keys() const { return &stub_keys_; }
 
  private:
+  static MaybeHandle<SharedFunctionInfo> DeserializeChecked(
+      Isolate* isolate, SerializedCodeData* scd, Handle<String> source);
+  static MaybeHandle<HeapObject> DeserializeRoot(Isolate* isolate,
+                                                 SerializedCodeData* scd,
+                                                 Handle<String> source);
+
   CodeSerializer(Isolate* isolate, SnapshotByteSink* sink, String* source)
       : Serializer(isolate, sink), source_(source) {
     back_reference_map_.AddSourceString(source);
@@ -757,6 +783,17 @@ class SerializedCodeData : public SerializedData {
                                             ScriptData* cached_data,
                                             String* source);
 
+  // Used when consuming on a background thread. Performs every check that
+  // does not need the source string or the heap, comparing against values
+  // computed on the main thread. Returns NULL if a check fails and stores the
+  // reason in |rejection_reason|; the caller records it.
+  static SerializedCodeData* FromCachedDataOffThread(
+      ScriptData* cached_data, uint32_t expected_magic_number,
+      uint32_t expected_flag_hash, int* rejection_reason);
+
+  // Completes the checks of FromCachedDataOffThread on the main thread.
+  bool MatchesSource(String* source) const;
+
   // Used when producing.
   SerializedCodeData(const List<byte>& payload, const CodeSerializer& cs);
 
@@ -782,6 +819,13 @@ class SerializedCodeData : public SerializedData {
   };
 
   SanityCheckResult SanityCheck(Isolate* isolate, String* source) const;
+  SanityCheckResult SanityCheckWithoutSource(uint32_t expected_magic_number,
+                                             uint32_t expected_flag_hash) const;
+  // Checks the header in the order magic number, version, source (unless
+  // |source| is NULL), CPU features, flags and checksum.
+  SanityCheckResult SanityCheckImpl(uint32_t expected_magic_number,
+                                    uint32_t expected_flag_hash,
+                                    String* source) const;
 
   uint32_t SourceHash(String* source) const;
 
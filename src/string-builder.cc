@@ -4,8 +4,10 @@
 
 #include "src/string-builder.h"
 
+#include "include/v8-profiler.h"
 #include "src/isolate-inl.h"
 #include "src/objects-inl.h"
+#include "src/unicode-inl.h"
 
 namespace v8 {
 namespace internal {
@@ -106,5 +108,109 @@ void IncrementalStringBuilder::AppendString(Handle<String> string) {
   Extend();  // Attach current part and allocate new part.
   Accumulate(string);
 }
+
+
+Utf8BufferBuilder::Utf8BufferBuilder(char* buffer, size_t capacity)
+    : stream_(NULL),
+      buffer_(buffer),
+      capacity_(capacity),
+      position_(0),
+      length_(0),
+      truncated_(false),
+      lead_surrogate_(unibrow::Utf16::kNoPreviousCharacter) {}
+
+
+Utf8BufferBuilder::Utf8BufferBuilder(v8::OutputStream* stream)
+    : stream_(stream),
+      position_(0),
+      length_(0),
+      truncated_(false),
+      lead_surrogate_(unibrow::Utf16::kNoPreviousCharacter) {
+  DCHECK(stream->GetChunkSize() > 0);
+  // Every character has to fit into a chunk.
+  capacity_ = Max(stream->GetChunkSize(),
+                  static_cast<int>(unibrow::Utf8::kMaxEncodedSize));
+  buffer_ = NewArray<char>(capacity_);
+}
+
+
+Utf8BufferBuilder::~Utf8BufferBuilder() {
+  if (stream_ != NULL) DeleteArray(buffer_);
+}
+
+
+void Utf8BufferBuilder::AppendString(Handle<String> string) {
+  string = String::Flatten(string);
+  DisallowHeapAllocation no_gc;
+  String::FlatContent content = string->GetFlatContent();
+  if (content.IsOneByte()) {
+    Vector<const uint8_t> chars = content.ToOneByteVector();
+    for (int i = 0; i < chars.length(); i++) AppendCodeUnit(chars[i]);
+  } else {
+    Vector<const uc16> chars = content.ToUC16Vector();
+    for (int i = 0; i < chars.length(); i++) AppendCodeUnit(chars[i]);
+  }
+}
+
+
+size_t Utf8BufferBuilder::Finish() {
+  if (lead_surrogate_ != unibrow::Utf16::kNoPreviousCharacter) {
+    char bytes[unibrow::Utf8::kMaxEncodedSize];
+    lead_surrogate_ = unibrow::Utf16::kNoPreviousCharacter;
+    AppendBytes(bytes, unibrow::Utf8::Encode(bytes, unibrow::Utf8::kBadChar,
+                                             lead_surrogate_));
+  }
+  if (stream_ != NULL && !truncated_) {
+    if (position_ > 0) WriteChunk();
+    if (!truncated_) stream_->EndOfStream();
+  }
+  return length_;
+}
+
+
+void Utf8BufferBuilder::AppendCodeUnitSlow(uc16 c) {
+  const int kNoPrevious = unibrow::Utf16::kNoPreviousCharacter;
+  char bytes[unibrow::Utf8::kMaxEncodedSize];
+  if (lead_surrogate_ != kNoPrevious) {
+    int lead = lead_surrogate_;
+    lead_surrogate_ = kNoPrevious;
+    if (unibrow::Utf16::IsTrailSurrogate(c)) {
+      unibrow::uchar code_point =
+          unibrow::Utf16::CombineSurrogatePair(lead, c);
+      AppendBytes(bytes, unibrow::Utf8::Encode(bytes, code_point, kNoPrevious));
+      return;
+    }
+    AppendBytes(bytes, unibrow::Utf8::Encode(bytes, unibrow::Utf8::kBadChar,
+                                             kNoPrevious));
+  }
+  if (unibrow::Utf16::IsLeadSurrogate(c)) {
+    lead_surrogate_ = c;
+    return;
+  }
+  AppendBytes(bytes, unibrow::Utf8::Encode(bytes, c, kNoPrevious, true));
+}
+
+
+void Utf8BufferBuilder::AppendBytes(const char* bytes, size_t count) {
+  if (stream_ != NULL && !truncated_ && count > capacity_ - position_) {
+    WriteChunk();
+  }
+  if (!truncated_ && count <= capacity_ - position_) {
+    MemCopy(buffer_ + position_, bytes, count);
+    position_ += count;
+  } else {
+    truncated_ = true;
+  }
+  length_ += count;
+}
+
+
+void Utf8BufferBuilder::WriteChunk() {
+  if (stream_->WriteAsciiChunk(buffer_, static_cast<int>(position_)) ==
+      v8::OutputStream::kAbort) {
+    truncated_ = true;
+  }
+  position_ = 0;
+}
 }  // namespace internal
 }  // namespace v8
@@ -431,6 +431,95 @@ void IncrementalStringBuilder::Append(SrcChar c) {
   }
   if (current_index_ == part_length_) Extend();
 }
+
+
+// Writes UTF-8 into a buffer instead of building a string on the heap. Offers
+// the parts of the IncrementalStringBuilder interface the JsonStringifier
+// uses; characters are always appended as UTF-16 code units. Orphan
+// surrogates are replaced with U+FFFD.
+//
+// With a caller-supplied buffer, nothing more is written once a character
+// does not fit, but the length of the output is still counted. With an
+// OutputStream, a buffer of one chunk is written to the stream whenever it
+// fills up, until the stream aborts.
+class Utf8BufferBuilder {
+ public:
+  Utf8BufferBuilder(char* buffer, size_t capacity);
+  explicit Utf8BufferBuilder(v8::OutputStream* stream);
+  ~Utf8BufferBuilder();
+
+  INLINE(String::Encoding CurrentEncoding()) {
+    return String::TWO_BYTE_ENCODING;
+  }
+
+  template <typename SrcChar, typename DestChar>
+  INLINE(void Append(SrcChar c)) {
+    AppendCodeUnit(c);
+  }
+
+  INLINE(void AppendCharacter(uint8_t c)) { AppendCodeUnit(c); }
+
+  INLINE(void AppendCString(const char* s)) {
+    const uint8_t* u = reinterpret_cast<const uint8_t*>(s);
+    while (*u != '\0') AppendCodeUnit(*(u++));
+  }
+
+  // The buffer is never extended, there is no need to check ahead.
+  INLINE(bool CurrentPartCanFit(int length)) { return true; }
+
+  void AppendString(Handle<String> string);
+
+  // Returns the length of the output in bytes, which is larger than the
+  // capacity if the output has been truncated. Writes the last chunk and ends
+  // the stream, if any.
+  size_t Finish();
+
+  void ChangeEncoding() { UNREACHABLE(); }
+
+  template <typename DestChar>
+  class NoExtendBuilder {
+   public:
+    NoExtendBuilder(Utf8BufferBuilder* builder, int required_length)
+        : builder_(builder) {}
+
+    INLINE(void Append(DestChar c)) { builder_->AppendCodeUnit(c); }
+    INLINE(void AppendCString(const char* s)) { builder_->AppendCString(s); }
+
+   private:
+    Utf8BufferBuilder* builder_;
+    DisallowHeapAllocation no_gc_;
+  };
+
+ private:
+  INLINE(void AppendCodeUnit(uc16 c)) {
+    if (c > unibrow::Utf8::kMaxOneByteChar ||
+        lead_surrogate_ != unibrow::Utf16::kNoPreviousCharacter) {
+      AppendCodeUnitSlow(c);
+      return;
+    }
+    if (!truncated_ && position_ < capacity_) {
+      buffer_[position_++] = static_cast<char>(c);
+      length_++;
+      return;
+    }
+    char byte = static_cast<char>(c);
+    AppendBytes(&byte, 1);
+  }
+
+  void AppendCodeUnitSlow(uc16 c);
+  void AppendBytes(const char* bytes, size_t count);
+  void WriteChunk();
+
+  v8::OutputStream* stream_;
+  char* buffer_;  // Owned if there is a stream.
+  size_t capacity_;
+  size_t position_;
+  size_t length_;
+  // Set when a character did not fit or the stream aborted.
+  bool truncated_;
+  // A lead surrogate waiting for its trail surrogate.
+  int lead_surrogate_;
+};
 }  // namespace internal
 }  // namespace v8
 
@@ -5,6 +5,7 @@
 #ifndef V8_STRING_SEARCH_H_
 #define V8_STRING_SEARCH_H_
 
+#include "src/code-unit-word.h"
 #include "src/isolate.h"
 #include "src/vector.h"
 
@@ -41,6 +42,12 @@ class StringSearchBase {
   // to compensate for the algorithmic overhead compared to simple brute force.
   static const int kBMMinPatternLength = 7;
 
+  // The linear search switches to comparing the first and last characters a
+  // word at a time once it has found a candidate for every
+  // kLinearSearchMinSkip characters on average, beyond an initial allowance.
+  static const int kLinearSearchMinSkip = 16;
+  static const int kLinearSearchAllowance = 64;
+
   static inline bool IsOneByteString(Vector<const uint8_t> string) {
     return true;
   }
@@ -113,6 +120,11 @@ class StringSearch : private StringSearchBase {
                           Vector<const SubjectChar> subject,
                           int start_index);
 
+  static int FirstLastCharSearch(
+      StringSearch<PatternChar, SubjectChar>* search,
+      Vector<const SubjectChar> subject,
+      int start_index);
+
   static int InitialSearch(StringSearch<PatternChar, SubjectChar>* search,
                            Vector<const SubjectChar> subject,
                            int start_index);
@@ -270,7 +282,9 @@ inline bool CharCompare(const PatternChar* pattern,
 }
 
 
-// Simple linear search for short patterns. Never bails out.
+// Simple linear search for short patterns. Switches to the first and last
+// character search if the first character of the pattern is too common in
+// the subject for memchr to skip ahead far.
 template <typename PatternChar, typename SubjectChar>
 int StringSearch<PatternChar, SubjectChar>::LinearSearch(
     StringSearch<PatternChar, SubjectChar>* search,
@@ -281,11 +295,13 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   int pattern_length = pattern.length();
   int i = index;
   int n = subject.length() - pattern_length;
+  int badness = -kLinearSearchAllowance;
   while (i <= n) {
-    i = FindFirstCharacter(pattern, subject, i);
-    if (i == -1) return -1;
-    DCHECK_LE(i, n);
-    i++;
+    int candidate = FindFirstCharacter(pattern, subject, i);
+    if (candidate == -1) return -1;
+    DCHECK_LE(candidate, n);
+    badness += kLinearSearchMinSkip - (candidate - i);
+    i = candidate + 1;
     // Loop extracted to separate function to allow using return to do
     // a deeper break.
     if (CharCompare(pattern.start() + 1,
@@ -293,6 +309,62 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
                     pattern_length - 1)) {
       return i - 1;
     }
+    if (badness > 0) {
+      search->strategy_ = &FirstLastCharSearch;
+      return FirstLastCharSearch(search, subject, i);
+    }
+  }
+  return -1;
+}
+
+//---------------------------------------------------------------------
+// First and Last Character Search Strategy
+//---------------------------------------------------------------------
+
+// Looks for the first and the last character of a short pattern at once,
+// testing a word of possible match positions at a time. Only positions where
+// both characters occur are compared in full.
+template <typename PatternChar, typename SubjectChar>
+int StringSearch<PatternChar, SubjectChar>::FirstLastCharSearch(
+    StringSearch<PatternChar, SubjectChar>* search,
+    Vector<const SubjectChar> subject,
+    int index) {
+  typedef CodeUnitWord<SubjectChar> Word;
+  Vector<const PatternChar> pattern = search->pattern_;
+  int pattern_length = pattern.length();
+  DCHECK(pattern_length > 1);
+  // The constructor rejects patterns which do not fit into SubjectChar.
+  const SubjectChar first_char = static_cast<SubjectChar>(pattern[0]);
+  const SubjectChar last_char =
+      static_cast<SubjectChar>(pattern[pattern_length - 1]);
+  const SubjectChar* chars = subject.start();
+  int n = subject.length() - pattern_length;
+  int i = index;
+  // The words hold the characters at positions i to i + kPerWord - 1 and
+  // pattern_length - 1 positions further.
+  for (; i + Word::kPerWord - 1 <= n; i += Word::kPerWord) {
+    uintptr_t firsts = ReadUnalignedValue<uintptr_t>(chars + i);
+    uintptr_t lasts =
+        ReadUnalignedValue<uintptr_t>(chars + i + pattern_length - 1);
+    if ((Word::EqualsMask(firsts, first_char) &
+         Word::EqualsMask(lasts, last_char)) == 0) {
+      continue;
+    }
+    for (int j = i; j < i + Word::kPerWord; j++) {
+      if (chars[j] == first_char &&
+          chars[j + pattern_length - 1] == last_char &&
+          (pattern_length == 2 ||
+           CharCompare(pattern.start() + 1, chars + j + 1,
+                       pattern_length - 2))) {
+        return j;
+      }
+    }
+  }
+  for (; i <= n; i++) {
+    if (chars[i] == first_char &&
+        CharCompare(pattern.start() + 1, chars + i + 1, pattern_length - 1)) {
+      return i;
+    }
   }
   return -1;
 }
@@ -563,6 +635,99 @@ int SearchString(Isolate* isolate,
   return search.Search(subject, start_index);
 }
 
+
+//---------------------------------------------------------------------
+// Searching ropes
+//---------------------------------------------------------------------
+
+// Searches a string one segment at a time, see StringSegmentIterator, so that
+// cons strings need not be flattened. Matches that span the boundary between
+// two segments are found by searching a window of the last
+// pattern.length() - 1 characters before the boundary followed by the first
+// pattern.length() - 1 characters after it. Heap allocation must be
+// disallowed while searching.
+template <typename PatternChar>
+class SegmentedStringSearch {
+ public:
+  SegmentedStringSearch(Isolate* isolate, Vector<const PatternChar> pattern)
+      : pattern_length_(pattern.length()),
+        one_byte_search_(isolate, pattern),
+        two_byte_search_(isolate, pattern),
+        window_(2 * (pattern.length() - 1)),
+        carry_(0),
+        position_(0) {}
+
+  int Search(String* subject, int start_index) {
+    carry_ = 0;
+    position_ = 0;
+    StringSegmentIterator segments(subject);
+    while (!segments.done()) {
+      String::FlatContent segment = segments.Next();
+      int index =
+          segment.IsOneByte()
+              ? SearchSegment(&one_byte_search_, segment.ToOneByteVector(),
+                              start_index)
+              : SearchSegment(&two_byte_search_, segment.ToUC16Vector(),
+                              start_index);
+      if (index != -1) return index;
+    }
+    return -1;
+  }
+
+ private:
+  template <typename SubjectChar>
+  int SearchSegment(StringSearch<PatternChar, SubjectChar>* search,
+                    Vector<const SubjectChar> segment, int start_index) {
+    int length = segment.length();
+    int result = -1;
+    if (carry_ > 0) {
+      // Matches which start in the carried characters.
+      int window_start = position_ - carry_;
+      int window_length = carry_ + Min(pattern_length_ - 1, length);
+      for (int i = carry_; i < window_length; i++) {
+        window_[i] = segment[i - carry_];
+      }
+      int from = Max(0, start_index - window_start);
+      if (from < carry_ && from + pattern_length_ <= window_length) {
+        int index = two_byte_search_.Search(
+            Vector<const uc16>(window_.start(), window_length), from);
+        if (index != -1) {
+          DCHECK_LT(index, carry_);
+          result = window_start + index;
+        }
+      }
+    }
+    if (result == -1) {
+      int from = Max(0, start_index - position_);
+      if (from + pattern_length_ <= length) {
+        int index = search->Search(segment, from);
+        if (index != -1) result = position_ + index;
+      }
+    }
+    // Carry the last pattern_length_ - 1 characters to the next boundary.
+    int keep = Min(pattern_length_ - 1, carry_ + length);
+    int kept = Max(0, keep - length);
+    for (int i = 0; i < kept; i++) {
+      window_[i] = window_[carry_ - kept + i];
+    }
+    for (int i = kept; i < keep; i++) {
+      window_[i] = segment[length - keep + i];
+    }
+    carry_ = keep;
+    position_ += length;
+    return result;
+  }
+
+  int pattern_length_;
+  StringSearch<PatternChar, uint8_t> one_byte_search_;
+  StringSearch<PatternChar, uc16> two_byte_search_;
+  ScopedVector<uc16> window_;
+  // The number of characters before the current segment in window_.
+  int carry_;
+  // The position of the current segment in the subject.
+  int position_;
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -283,6 +283,7 @@ Type::bitset BitsetType::Lub(i::Map* map) {
     case WEAK_CELL_TYPE:
     case PROTOTYPE_INFO_TYPE:
     case SLOPPY_BLOCK_WITH_EVAL_CONTEXT_EXTENSION_TYPE:
+    case PROMISE_REACTION_JOB_INFO_TYPE:
       UNREACHABLE();
       return kNone;
   }
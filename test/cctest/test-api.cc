@@ -36,6 +36,7 @@
 #include <unistd.h>  // NOLINT
 #endif
 
+#include "include/v8-profiler.h"
 #include "include/v8-util.h"
 #include "src/api.h"
 #include "src/arguments.h"
@@ -45,6 +46,7 @@
 #include "src/debug/debug.h"
 #include "src/execution.h"
 #include "src/futex-emulation.h"
+#include "src/ic/stub-cache.h"
 #include "src/objects.h"
 #include "src/parsing/parser.h"
 #include "src/unicode-inl.h"
@@ -19725,6 +19727,51 @@ TEST(InitializeDefaultIsolateOnSecondaryThread5) {
 }
 
 
+TEST(StubCacheSize) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  create_params.constraints.set_stub_cache_size(5000);
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    LocalContext env(isolate);
+    i::StubCache* stub_cache =
+        reinterpret_cast<i::Isolate*>(isolate)->stub_cache();
+    CHECK_EQ(8192, stub_cache->primary_table_size());
+    CHECK_EQ(2048, stub_cache->secondary_table_size());
+    // Megamorphic loads and stores on many maps go through the probing code
+    // generated for the larger tables.
+    CompileRun(
+        "function get(o) { return o.x; }"
+        "function set(o, v) { o.x = v; }"
+        "var objects = [];"
+        "for (var i = 0; i < 500; i++) {"
+        "  var o = { x: i };"
+        "  o['p' + i] = i;"
+        "  objects.push(o);"
+        "}"
+        "var sum = 0;"
+        "for (var k = 0; k < 3; k++) {"
+        "  for (var i = 0; i < objects.length; i++) {"
+        "    set(objects[i], get(objects[i]) + 1);"
+        "    sum += get(objects[i]);"
+        "  }"
+        "}");
+    ExpectInt32("sum", 3 * (500 * 499 / 2) + 500 * (1 + 2 + 3));
+  }
+  isolate->Dispose();
+
+  // Sizes are clamped to the supported range.
+  CHECK_EQ(i::StubCache::kDefaultPrimaryTableBits,
+           i::StubCache::PrimaryTableBitsForSize(0));
+  CHECK_EQ(i::StubCache::kMinPrimaryTableBits,
+           i::StubCache::PrimaryTableBitsForSize(1));
+  CHECK_EQ(i::StubCache::kMaxPrimaryTableBits,
+           i::StubCache::PrimaryTableBitsForSize(1 << 30));
+}
+
+
 TEST(StringCheckMultipleContexts) {
   const char* code =
       "(function() { return \"a\".charAt(0); })()";
@@ -20006,6 +20053,35 @@ TEST(RegExp) {
 }
 
 
+TEST(RegExpLinear) {
+  LocalContext context;
+  v8::HandleScope scope(context->GetIsolate());
+
+  // Nested quantifiers take exponential time to fail when backtracking.
+  v8::Local<v8::RegExp> re =
+      v8::RegExp::New(context.local(), v8_str("(a+)+b"), v8::RegExp::kLinear)
+          .ToLocalChecked();
+  CHECK_EQ(v8::RegExp::kLinear, re->GetFlags());
+  CHECK(context->Global()->Set(context.local(), v8_str("re"), re).FromJust());
+  ExpectTrue("re.exec('a'.repeat(100000)) === null");
+  ExpectString("re.exec('xaaab').join()", "aaab,aaa");
+
+  re = v8::RegExp::New(context.local(), v8_str("(\\w+\\s?)*$"),
+                       static_cast<v8::RegExp::Flags>(v8::RegExp::kLinear |
+                                                      v8::RegExp::kGlobal))
+           .ToLocalChecked();
+  CHECK(context->Global()->Set(context.local(), v8_str("re"), re).FromJust());
+  ExpectTrue("re.test('foo bar '.repeat(10000) + '!')");
+  ExpectInt32("re.lastIndex", 80001);
+
+  // Backreferences are not supported and fall back to irregexp.
+  re = v8::RegExp::New(context.local(), v8_str("(a)\\1"), v8::RegExp::kLinear)
+           .ToLocalChecked();
+  CHECK(context->Global()->Set(context.local(), v8_str("re"), re).FromJust());
+  ExpectString("re.exec('baab').join()", "aa,a");
+}
+
+
 THREADED_TEST(Equals) {
   LocalContext localContext;
   v8::HandleScope handleScope(localContext->GetIsolate());
@@ -21815,6 +21891,220 @@ THREADED_TEST(JSONParseNumber) {
 }
 
 
+class JsonParseThread : public v8::base::Thread {
+ public:
+  explicit JsonParseThread(v8::JSON::ParseTask* task)
+      : Thread(Options("JsonParseThread")), task_(task) {}
+
+  virtual void Run() { task_->Run(); }
+
+ private:
+  v8::JSON::ParseTask* task_;
+};
+
+
+TEST(JSONParsePreparedSource) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  const char* json =
+      "{\"a\":[1,-2,3.5,1e3,12345678901,true,false,null],"
+      "\"b\":{\"c\":\"d\\n\\u00e9\\u20ac\",\"0\":1,\"12\":[]},"
+      "\"\":{},\"a\\u0062\":\"\"}";
+  v8::JSON::PreparedSource source(reinterpret_cast<const uint8_t*>(json),
+                                  static_cast<int>(strlen(json)));
+  v8::JSON::ParseTask* task = v8::JSON::StartParsing(isolate, &source);
+  JsonParseThread thread(task);
+  thread.Start();
+  thread.Join();
+  delete task;
+
+  Local<Value> obj = v8::JSON::Parse(isolate, &source).ToLocalChecked();
+  context->Global()->Set(context.local(), v8_str("obj"), obj).FromJust();
+  Local<Value> expected =
+      v8::JSON::Parse(isolate, v8_str(json)).ToLocalChecked();
+  context->Global()
+      ->Set(context.local(), v8_str("expected"), expected)
+      .FromJust();
+  ExpectTrue("JSON.stringify(obj) === JSON.stringify(expected)");
+  ExpectString("obj.b.c", "d\n\u00e9\u20ac");
+  ExpectInt32("obj.b[12].length", 0);
+  ExpectString("obj.ab", "");
+}
+
+
+TEST(JSONParsePreparedSourceTwoByte) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  const uint16_t json[] = {'[', '"', 0x20ac, '"', ',', '{', '"', 'x',
+                           '"', ':', '4', '2', '}', ']'};
+  v8::JSON::PreparedSource source(json, arraysize(json));
+  // Without a task, the source is tokenized when it is parsed.
+  Local<Value> obj = v8::JSON::Parse(isolate, &source).ToLocalChecked();
+  context->Global()->Set(context.local(), v8_str("obj"), obj).FromJust();
+  ExpectString("JSON.stringify(obj)", "[\"\u20ac\",{\"x\":42}]");
+}
+
+
+TEST(JSONParsePreparedSourceErrors) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  const char* json = "{\"x\": [1, 2,]}";
+  {
+    v8::JSON::PreparedSource source(reinterpret_cast<const uint8_t*>(json),
+                                    static_cast<int>(strlen(json)));
+    v8::TryCatch try_catch(isolate);
+    CHECK(v8::JSON::Parse(isolate, &source).IsEmpty());
+    CHECK(try_catch.HasCaught());
+    CHECK(try_catch.Exception()->IsNativeError());
+  }
+  {
+    // A cancelled source returns an empty handle without throwing.
+    v8::JSON::PreparedSource source(reinterpret_cast<const uint8_t*>(json),
+                                    static_cast<int>(strlen(json)));
+    v8::JSON::ParseTask* task = v8::JSON::StartParsing(isolate, &source);
+    source.Cancel();
+    task->Run();
+    delete task;
+    v8::TryCatch try_catch(isolate);
+    CHECK(v8::JSON::Parse(isolate, &source).IsEmpty());
+    CHECK(!try_catch.HasCaught());
+  }
+}
+
+
+TEST(JSONStringifyToUtf8) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  char buffer[64];
+  Local<Value> value = CompileRun(
+      "[{a: 1, 'b\"': 1.5, c: 'x'}, {a: 2, 'b\"': 2.5, c: '\\u00e4\\u20ac'}]");
+  const char* expected =
+      "[{\"a\":1,\"b\\\"\":1.5,\"c\":\"x\"},"
+      "{\"a\":2,\"b\\\"\":2.5,\"c\":\"\xc3\xa4\xe2\x82\xac\"}]";
+  size_t length = v8::JSON::StringifyToUtf8(context.local(), value, buffer,
+                                            sizeof(buffer)).FromJust();
+  CHECK_EQ(strlen(expected), length);
+  CHECK_EQ(0, memcmp(expected, buffer, length));
+
+  // Surrogate pairs are combined, orphans are replaced.
+  value = CompileRun("'\\ud83d\\ude00\\ud83d'");
+  const char* expected_surrogates = "\"\xf0\x9f\x98\x80\xef\xbf\xbd\"";
+  length = v8::JSON::StringifyToUtf8(context.local(), value, buffer,
+                                     sizeof(buffer)).FromJust();
+  CHECK_EQ(strlen(expected_surrogates), length);
+  CHECK_EQ(0, memcmp(expected_surrogates, buffer, length));
+
+  // Only complete characters are written when the output is truncated.
+  value = CompileRun("'\\u20ac\\u20ac'");
+  memset(buffer, 0, sizeof(buffer));
+  length = v8::JSON::StringifyToUtf8(context.local(), value, buffer, 5)
+               .FromJust();
+  CHECK_EQ(8u, length);
+  CHECK_EQ(0, memcmp("\"\xe2\x82\xac", buffer, 4));
+  CHECK_EQ(0, buffer[4]);
+
+  value = v8::Undefined(isolate);
+  CHECK_EQ(0u, v8::JSON::StringifyToUtf8(context.local(), value, buffer,
+                                         sizeof(buffer)).FromJust());
+}
+
+
+class JsonChunkStream : public v8::OutputStream {
+ public:
+  explicit JsonChunkStream(int abort_after_chunks = -1)
+      : chunks_(0),
+        end_of_stream_(false),
+        abort_after_chunks_(abort_after_chunks) {}
+  virtual int GetChunkSize() { return 8; }
+  virtual void EndOfStream() { end_of_stream_ = true; }
+  virtual WriteResult WriteAsciiChunk(char* buffer, int size) {
+    CHECK(size > 0 && size <= GetChunkSize());
+    if (chunks_ == abort_after_chunks_) return kAbort;
+    chunks_++;
+    output_.append(buffer, size);
+    return kContinue;
+  }
+
+  const std::string& output() const { return output_; }
+  int chunks() const { return chunks_; }
+  bool end_of_stream() const { return end_of_stream_; }
+
+ private:
+  std::string output_;
+  int chunks_;
+  bool end_of_stream_;
+  int abort_after_chunks_;
+};
+
+
+TEST(JSONStringifyToOutputStream) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  Local<Value> value = CompileRun(
+      "var a = []; for (var i = 0; i < 100; i++) a.push({i: i, s: '\\u20ac'});"
+      "a");
+  std::string expected;
+  for (int i = 0; i < 100; i++) {
+    i::EmbeddedVector<char, 32> element;
+    i::SNPrintF(element, "%c{\"i\":%d,\"s\":\"\xe2\x82\xac\"}",
+                i == 0 ? '[' : ',', i);
+    expected += element.start();
+  }
+  expected += "]";
+  {
+    JsonChunkStream stream;
+    size_t length =
+        v8::JSON::Stringify(context.local(), value, &stream).FromJust();
+    CHECK_EQ(expected.length(), length);
+    CHECK(expected == stream.output());
+    CHECK(stream.end_of_stream());
+  }
+  {
+    // Aborting stops the output but not the serialization.
+    JsonChunkStream stream(3);
+    size_t length =
+        v8::JSON::Stringify(context.local(), value, &stream).FromJust();
+    CHECK_EQ(expected.length(), length);
+    CHECK_EQ(3, stream.chunks());
+    CHECK(expected.compare(0, stream.output().length(), stream.output()) == 0);
+    CHECK(!stream.end_of_stream());
+  }
+  {
+    // The stream is ended even if there is no output.
+    JsonChunkStream stream;
+    CHECK_EQ(0u, v8::JSON::Stringify(context.local(), v8::Undefined(isolate),
+                                     &stream).FromJust());
+    CHECK_EQ(0, stream.chunks());
+    CHECK(stream.end_of_stream());
+  }
+}
+
+
+TEST(JSONStringifyToUtf8Exception) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  char buffer[16];
+  Local<Value> value = CompileRun("({ toJSON: function() { throw 42; } })");
+  v8::TryCatch try_catch(isolate);
+  CHECK(v8::JSON::StringifyToUtf8(context.local(), value, buffer,
+                                  sizeof(buffer)).IsNothing());
+  CHECK(try_catch.HasCaught());
+  CHECK_EQ(42, try_catch.Exception()->Int32Value(context.local()).FromJust());
+
+  try_catch.Reset();
+  value = CompileRun("var cyclic = {}; cyclic.self = cyclic; cyclic");
+  CHECK(v8::JSON::StringifyToUtf8(context.local(), value, buffer,
+                                  sizeof(buffer)).IsNothing());
+  CHECK(try_catch.HasCaught());
+}
+
+
 #if V8_OS_POSIX && !V8_OS_NACL
 class ThreadInterruptTest {
  public:
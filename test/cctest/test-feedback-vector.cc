@@ -6,6 +6,7 @@
 #include "test/cctest/cctest.h"
 
 #include "src/api.h"
+#include "src/code-stubs.h"
 #include "src/debug/debug.h"
 #include "src/execution.h"
 #include "src/factory.h"
@@ -376,6 +377,40 @@ TEST(VectorLoadICOnSmi) {
 }
 
 
+TEST(VectorLoadICSharedFieldHandler) {
+  if (i::FLAG_always_opt) return;
+  CcTest::InitializeVM();
+  LocalContext context;
+  v8::HandleScope scope(context->GetIsolate());
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+
+  // Both objects have foo in the second in-object field.
+  CompileRun(
+      "var o1 = { a: 1, foo: 2 };"
+      "var o2 = { b: 1, foo: 3 };"
+      "function f(a) { return a.foo; } f(o1); f(o1); f(o2);");
+  Handle<JSFunction> f = GetFunction("f");
+  Handle<TypeFeedbackVector> feedback_vector =
+      Handle<TypeFeedbackVector>(f->shared()->feedback_vector(), isolate);
+  FeedbackVectorSlot slot(0);
+  LoadICNexus nexus(feedback_vector, slot);
+  CHECK_EQ(POLYMORPHIC, nexus.StateFromFeedback());
+
+  // The maps share one field load stub, which is not cached on either map.
+  CodeHandleList handlers;
+  CHECK(nexus.FindHandlers(&handlers, 2));
+  CHECK(handlers.at(0).is_identical_to(handlers.at(1)));
+  CHECK_EQ(CodeStub::LoadField, CodeStub::GetMajorKey(*handlers.at(0)));
+  Handle<JSObject> o1 = Handle<JSObject>::cast(
+      v8::Utils::OpenHandle(*CompileRun("o1").As<v8::Object>()));
+  Handle<JSObject> o2 = Handle<JSObject>::cast(
+      v8::Utils::OpenHandle(*CompileRun("o2").As<v8::Object>()));
+  CHECK_EQ(heap->empty_fixed_array(), o1->map()->code_cache());
+  CHECK_EQ(heap->empty_fixed_array(), o2->map()->code_cache());
+}
+
+
 TEST(ReferenceContextAllocatesNoSlots) {
   if (i::FLAG_always_opt) return;
   CcTest::InitializeVM();
@@ -268,6 +268,67 @@ TEST(JSObjectComplexNoInlineNew) {
 }
 
 
+TEST(JSObjectOutOfObjectFeedback) {
+  // Avoid eventual completion of in-object slack tracking.
+  FLAG_inline_construct = false;
+  FLAG_always_opt = false;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  const char* source =
+      "function Outer() {"
+      "  return function A() { this.a = 42; };"
+      "}"
+      "var A1 = Outer();"
+      "var A2 = Outer();"
+      "function Grow(o) {"
+      "  o.b = 1; o.c = 2; o.d = 3; o.e = 4; o.f = 5; o.g = 6;"
+      "  o.h = 7; o.i = 8; o.j = 9; o.k = 10; o.l = 11; o.m = 12;"
+      "  return o;"
+      "}";
+  CompileRun(source);
+
+  Handle<JSFunction> func1 = GetGlobal<JSFunction>("A1");
+  Handle<JSFunction> func2 = GetGlobal<JSFunction>("A2");
+  CHECK_EQ(func1->shared(), func2->shared());
+
+  Handle<JSObject> obj1 = CompileRun<JSObject>("Grow(new A1());");
+  Handle<Map> initial_map(func1->initial_map());
+  int inobject_properties = initial_map->GetInObjectProperties();
+  int expected_nof_properties = func1->shared()->expected_nof_properties();
+
+  // The objects outgrow their in-object space.
+  CHECK_LT(inobject_properties, 13);
+  CHECK_EQ(13, obj1->map()->NumberOfFields());
+  CHECK_LT(0, obj1->properties()->length());
+
+  // Create several objects to complete the tracking.
+  for (int i = 1; i < Map::kGenerousAllocationCount; i++) {
+    CHECK(initial_map->IsInobjectSlackTrackingInProgress());
+    CompileRun("Grow(new A1());");
+  }
+  CHECK(!initial_map->IsInobjectSlackTrackingInProgress());
+
+  // There was no slack to reclaim, the initial map keeps its size.
+  CHECK_EQ(inobject_properties, initial_map->GetInObjectProperties());
+
+  // The out-of-object fields are remembered for later initial maps.
+  CHECK_EQ(expected_nof_properties + 13 - inobject_properties,
+           func1->shared()->expected_nof_properties());
+
+  Handle<JSObject> obj2 = CompileRun<JSObject>("Grow(new A2());");
+  CHECK(func2->initial_map()->IsInobjectSlackTrackingInProgress());
+  CHECK_LE(13, obj2->map()->GetInObjectProperties());
+  CHECK_EQ(13, obj2->map()->NumberOfFields());
+  CHECK_EQ(0, obj2->properties()->length());
+}
+
+
+TEST(JSObjectOutOfObjectFeedbackNoInlineNew) {
+  FLAG_inline_new = false;
+  TestJSObjectOutOfObjectFeedback();
+}
+
+
 TEST(JSGeneratorObjectBasic) {
   // Avoid eventual completion of in-object slack tracking.
   FLAG_inline_construct = false;
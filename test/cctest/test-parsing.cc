@@ -576,6 +576,8 @@ void TestCharacterStream(const char* one_byte_source, unsigned length,
       i::Handle<i::ExternalTwoByteString>::cast(uc16_string), start, end);
   i::GenericStringUtf16CharacterStream string_stream(one_byte_string, start,
                                                      end);
+  i::OneByteStringUtf16CharacterStream one_byte_stream(one_byte_string, start,
+                                                       end);
   i::Utf8ToUtf16CharacterStream utf8_stream(
       reinterpret_cast<const i::byte*>(one_byte_source), end);
   utf8_stream.SeekForward(start);
@@ -585,17 +587,21 @@ void TestCharacterStream(const char* one_byte_source, unsigned length,
     // Read streams one char at a time
     CHECK_EQU(i, uc16_stream.pos());
     CHECK_EQU(i, string_stream.pos());
+    CHECK_EQU(i, one_byte_stream.pos());
     CHECK_EQU(i, utf8_stream.pos());
     int32_t c0 = one_byte_source[i];
     int32_t c1 = uc16_stream.Advance();
     int32_t c2 = string_stream.Advance();
+    int32_t c4 = one_byte_stream.Advance();
     int32_t c3 = utf8_stream.Advance();
     i++;
     CHECK_EQ(c0, c1);
     CHECK_EQ(c0, c2);
+    CHECK_EQ(c0, c4);
     CHECK_EQ(c0, c3);
     CHECK_EQU(i, uc16_stream.pos());
     CHECK_EQU(i, string_stream.pos());
+    CHECK_EQU(i, one_byte_stream.pos());
     CHECK_EQU(i, utf8_stream.pos());
   }
   while (i > start + sub_length / 4) {
@@ -603,64 +609,80 @@ void TestCharacterStream(const char* one_byte_source, unsigned length,
     int32_t c0 = one_byte_source[i - 1];
     CHECK_EQU(i, uc16_stream.pos());
     CHECK_EQU(i, string_stream.pos());
+    CHECK_EQU(i, one_byte_stream.pos());
     CHECK_EQU(i, utf8_stream.pos());
     uc16_stream.PushBack(c0);
     string_stream.PushBack(c0);
+    one_byte_stream.PushBack(c0);
     utf8_stream.PushBack(c0);
     i--;
     CHECK_EQU(i, uc16_stream.pos());
     CHECK_EQU(i, string_stream.pos());
+    CHECK_EQU(i, one_byte_stream.pos());
     CHECK_EQU(i, utf8_stream.pos());
     int32_t c1 = uc16_stream.Advance();
     int32_t c2 = string_stream.Advance();
+    int32_t c4 = one_byte_stream.Advance();
     int32_t c3 = utf8_stream.Advance();
     i++;
     CHECK_EQU(i, uc16_stream.pos());
     CHECK_EQU(i, string_stream.pos());
+    CHECK_EQU(i, one_byte_stream.pos());
     CHECK_EQU(i, utf8_stream.pos());
     CHECK_EQ(c0, c1);
     CHECK_EQ(c0, c2);
+    CHECK_EQ(c0, c4);
     CHECK_EQ(c0, c3);
     uc16_stream.PushBack(c0);
     string_stream.PushBack(c0);
+    one_byte_stream.PushBack(c0);
     utf8_stream.PushBack(c0);
     i--;
     CHECK_EQU(i, uc16_stream.pos());
     CHECK_EQU(i, string_stream.pos());
+    CHECK_EQU(i, one_byte_stream.pos());
     CHECK_EQU(i, utf8_stream.pos());
   }
   unsigned halfway = start + sub_length / 2;
   uc16_stream.SeekForward(halfway - i);
   string_stream.SeekForward(halfway - i);
+  one_byte_stream.SeekForward(halfway - i);
   utf8_stream.SeekForward(halfway - i);
   i = halfway;
   CHECK_EQU(i, uc16_stream.pos());
   CHECK_EQU(i, string_stream.pos());
+  CHECK_EQU(i, one_byte_stream.pos());
   CHECK_EQU(i, utf8_stream.pos());
 
   while (i < end) {
     // Read streams one char at a time
     CHECK_EQU(i, uc16_stream.pos());
     CHECK_EQU(i, string_stream.pos());
+    CHECK_EQU(i, one_byte_stream.pos());
     CHECK_EQU(i, utf8_stream.pos());
     int32_t c0 = one_byte_source[i];
     int32_t c1 = uc16_stream.Advance();
     int32_t c2 = string_stream.Advance();
+    int32_t c4 = one_byte_stream.Advance();
     int32_t c3 = utf8_stream.Advance();
     i++;
     CHECK_EQ(c0, c1);
     CHECK_EQ(c0, c2);
+    CHECK_EQ(c0, c4);
     CHECK_EQ(c0, c3);
     CHECK_EQU(i, uc16_stream.pos());
     CHECK_EQU(i, string_stream.pos());
+    CHECK_EQU(i, one_byte_stream.pos());
     CHECK_EQU(i, utf8_stream.pos());
   }
 
   int32_t c1 = uc16_stream.Advance();
   int32_t c2 = string_stream.Advance();
+  int32_t c4 = one_byte_stream.Advance();
   int32_t c3 = utf8_stream.Advance();
   CHECK_LT(c1, 0);
   CHECK_LT(c2, 0);
+  CHECK_LT(c4, 0);
   CHECK_LT(c3, 0);
 }
 
@@ -686,6 +708,43 @@ TEST(CharacterStreams) {
 }
 
 
+TEST(OneByteStringScanning) {
+  // Tokens spanning the stream's buffer are scanned in place from the string.
+  i::Isolate* isolate = CcTest::i_isolate();
+  i::HandleScope scope(isolate);
+  i::Vector<char> source = i::Vector<char>::New(20000);
+  int length = 0;
+  while (length < source.length() - 100) {
+    length += i::SNPrintF(source.SubVector(length, source.length()),
+                          "/* comment %d */ ident_%d = 'string %d';\n"
+                          "// line comment\n",
+                          length, length, length);
+  }
+  i::Handle<i::String> string =
+      isolate->factory()
+          ->NewStringFromAscii(i::Vector<const char>(source.start(), length))
+          .ToHandleChecked();
+  CHECK(string->IsSeqOneByteString());
+
+  i::GenericStringUtf16CharacterStream generic_stream(string, 0, length);
+  i::OneByteStringUtf16CharacterStream one_byte_stream(string, 0, length);
+  i::Scanner generic_scanner(isolate->unicode_cache());
+  i::Scanner one_byte_scanner(isolate->unicode_cache());
+  generic_scanner.Initialize(&generic_stream);
+  one_byte_scanner.Initialize(&one_byte_stream);
+  i::Token::Value token;
+  do {
+    token = generic_scanner.Next();
+    CHECK_EQ(token, one_byte_scanner.Next());
+    CHECK_EQ(generic_scanner.location().beg_pos,
+             one_byte_scanner.location().beg_pos);
+    CHECK_EQ(generic_scanner.location().end_pos,
+             one_byte_scanner.location().end_pos);
+  } while (token != i::Token::EOS);
+  source.Dispose();
+}
+
+
 TEST(Utf8CharacterStream) {
   static const unsigned kMaxUC16CharU = unibrow::Utf8::kMaxThreeByteChar;
   static const int kMaxUC16Char = static_cast<int>(kMaxUC16CharU);
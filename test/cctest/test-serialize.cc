@@ -1517,6 +1517,178 @@ TEST(SerializeToplevelIsolates) {
 }
 
 
+class InMemoryCodeCacheStore
+    : public v8::ScriptCompiler::CodeCacheBackingStore {
+ public:
+  InMemoryCodeCacheStore() : lookups(0), hits(0), rejects(0), stores(0) {}
+  ~InMemoryCodeCacheStore() override {
+    for (int i = 0; i < entries_.length(); i++) entries_[i].data.Dispose();
+  }
+
+  const v8::ScriptCompiler::CachedData* Lookup(uint64_t key) override {
+    lookups++;
+    Entry* entry = Find(key);
+    if (entry == NULL) return NULL;
+    hits++;
+    return new v8::ScriptCompiler::CachedData(entry->data.start(),
+                                              entry->data.length());
+  }
+
+  void Release(const v8::ScriptCompiler::CachedData* data,
+               bool rejected) override {
+    if (rejected) rejects++;
+    delete data;
+  }
+
+  void Store(uint64_t key, const uint8_t* data, int length) override {
+    stores++;
+    Entry* entry = Find(key);
+    if (entry == NULL) {
+      Entry new_entry = {key, Vector<uint8_t>()};
+      entries_.Add(new_entry);
+      entry = &entries_.last();
+    }
+    entry->data.Dispose();
+    entry->data = Vector<uint8_t>::New(length);
+    MemCopy(entry->data.start(), data, length);
+  }
+
+  int lookups;
+  int hits;
+  int rejects;
+  int stores;
+
+ private:
+  struct Entry {
+    uint64_t key;
+    Vector<uint8_t> data;
+  };
+
+  Entry* Find(uint64_t key) {
+    for (int i = 0; i < entries_.length(); i++) {
+      if (entries_[i].key == key) return &entries_[i];
+    }
+    return NULL;
+  }
+
+  List<Entry> entries_;
+};
+
+
+static void CompileAndRunWithBackingStore(
+    InMemoryCodeCacheStore* store, const char* source, const char* name,
+    bool expect_compile) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  create_params.code_cache_backing_store = store;
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str(name));
+    v8::ScriptCompiler::Source script_source(v8_str(source), origin);
+    v8::Local<v8::UnboundScript> script;
+    if (expect_compile) {
+      script = v8::ScriptCompiler::CompileUnboundScript(isolate, &script_source)
+                   .ToLocalChecked();
+    } else {
+      DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate));
+      script = v8::ScriptCompiler::CompileUnboundScript(isolate, &script_source)
+                   .ToLocalChecked();
+    }
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->ToString(context)
+              .ToLocalChecked()
+              ->Equals(context, v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate->Dispose();
+}
+
+
+TEST(CodeCacheBackingStore) {
+  FLAG_serialize_toplevel = true;
+
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  InMemoryCodeCacheStore store;
+
+  // The first isolate compiles the script and adds it to the store.
+  CompileAndRunWithBackingStore(&store, source, "test", true);
+  CHECK_EQ(1, store.lookups);
+  CHECK_EQ(0, store.hits);
+  CHECK_EQ(1, store.stores);
+
+  // The second isolate deserializes it from the store.
+  CompileAndRunWithBackingStore(&store, source, "test", false);
+  CHECK_EQ(2, store.lookups);
+  CHECK_EQ(1, store.hits);
+  CHECK_EQ(0, store.rejects);
+  CHECK_EQ(1, store.stores);
+
+  // A different origin results in a different key.
+  CompileAndRunWithBackingStore(&store, source, "other", true);
+  CHECK_EQ(3, store.lookups);
+  CHECK_EQ(1, store.hits);
+  CHECK_EQ(2, store.stores);
+}
+
+
+// Creates the regexp |literal| in a new isolate using |store|, checks that it
+// matches and returns whether it came with compiled code.
+static bool RunRegExpWithBackingStore(InMemoryCodeCacheStore* store,
+                                      const char* literal) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  create_params.code_cache_backing_store = store;
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  bool compiled;
+  {
+    v8::Isolate::Scope iscope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+
+    EmbeddedVector<char, 128> source;
+    SNPrintF(source, "var re = %s; re", literal);
+    v8::Local<v8::Value> value = CompileRun(source.start());
+    Handle<JSRegExp> regexp =
+        Handle<JSRegExp>::cast(v8::Utils::OpenHandle(*value));
+    CHECK_EQ(JSRegExp::IRREGEXP, regexp->TypeTag());
+    compiled = regexp->DataAt(JSRegExp::code_index(true))->IsCode();
+
+    v8::Local<v8::Value> result = CompileRun("re.exec('x 12-Ab')[2]");
+    CHECK(result->Equals(context, v8_str("Ab")).FromJust());
+  }
+  isolate->Dispose();
+  return compiled;
+}
+
+
+TEST(CodeCacheBackingStoreRegExp) {
+  InMemoryCodeCacheStore store;
+
+  // The first isolate compiles the regexp when it is first executed and adds
+  // the data with the code to the store.
+  CHECK(!RunRegExpWithBackingStore(&store, "/(\\d+)-(\\w+)/"));
+  int stores = store.stores;
+  CHECK_LT(0, stores);
+
+  // The second isolate gets the compiled regexp from the store.
+  int hits = store.hits;
+  CHECK(RunRegExpWithBackingStore(&store, "/(\\d+)-(\\w+)/"));
+  CHECK_LT(hits, store.hits);
+  CHECK_EQ(0, store.rejects);
+
+  // Different flags result in a different key.
+  CHECK(!RunRegExpWithBackingStore(&store, "/(\\d+)-(\\w+)/i"));
+  CHECK_LT(stores, store.stores);
+}
+
+
 TEST(SerializeToplevelFlagChange) {
   FLAG_serialize_toplevel = true;
 
@@ -1577,6 +1749,98 @@ TEST(SerializeToplevelBitFlip) {
 }
 
 
+class ConsumeCodeCacheThread : public v8::base::Thread {
+ public:
+  explicit ConsumeCodeCacheThread(
+      v8::ScriptCompiler::ConsumeCodeCacheTask* task)
+      : Thread(Options("ConsumeCodeCacheThread")), task_(task) {}
+
+  virtual void Run() { task_->Run(); }
+
+ private:
+  v8::ScriptCompiler::ConsumeCodeCacheTask* task_;
+};
+
+
+static void CompilePreparedCodeCache(const char* source,
+                                     v8::ScriptCompiler::CachedData* cache,
+                                     bool expect_rejection) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::PreparedCodeCache prepared(cache);
+    v8::ScriptCompiler::ConsumeCodeCacheTask* task =
+        v8::ScriptCompiler::StartConsumingCodeCache(isolate2, &prepared);
+    CHECK(task);
+    ConsumeCodeCacheThread thread(task);
+    thread.Start();
+    thread.Join();
+    delete task;
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin);
+    v8::Local<v8::UnboundScript> script;
+    if (expect_rejection) {
+      script = v8::ScriptCompiler::CompileUnboundScript(isolate2, &source,
+                                                        &prepared)
+                   .ToLocalChecked();
+    } else {
+      DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate2));
+      script = v8::ScriptCompiler::CompileUnboundScript(isolate2, &source,
+                                                        &prepared)
+                   .ToLocalChecked();
+    }
+    CHECK_EQ(expect_rejection, prepared.GetCachedData()->rejected);
+    v8::Local<v8::Value> result = script->BindToCurrentContext()
+                                      ->Run(isolate2->GetCurrentContext())
+                                      .ToLocalChecked();
+    CHECK(result->ToString(isolate2->GetCurrentContext())
+              .ToLocalChecked()
+              ->Equals(isolate2->GetCurrentContext(), v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+}
+
+
+TEST(SerializeToplevelConsumeOnBackgroundThread) {
+  FLAG_serialize_toplevel = true;
+
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  CompilePreparedCodeCache(source, ProduceCache(source), false);
+}
+
+
+TEST(SerializeToplevelConsumeOnBackgroundThreadBitFlip) {
+  FLAG_serialize_toplevel = true;
+
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = ProduceCache(source);
+
+  // Random bit flip, detected by the checksum on the background thread.
+  const_cast<uint8_t*>(cache->data)[337] ^= 0x40;
+
+  CompilePreparedCodeCache(source, cache, true);
+}
+
+
+TEST(SerializeToplevelConsumeOnBackgroundThreadSourceMismatch) {
+  FLAG_serialize_toplevel = true;
+
+  // The source hash can only be checked on the main thread.
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  const char* other = "function g() { return 'abc'; }; g() + 'def' ";
+  CompilePreparedCodeCache(other, ProduceCache(source), true);
+}
+
+
 TEST(SerializeWithHarmonyScoping) {
   FLAG_serialize_toplevel = true;
 
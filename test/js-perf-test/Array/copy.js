@@ -0,0 +1,120 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('ArrayCopy', [1000], [
+  new Benchmark('SliceSmi', false, false, 0, SliceSmi, CopySetup),
+  new Benchmark('SliceDouble', false, false, 0, SliceDouble, CopySetup),
+  new Benchmark('SliceObject', false, false, 0, SliceObject, CopySetup),
+  new Benchmark('SliceHoley', false, false, 0, SliceHoley, CopySetup),
+  new Benchmark('SpliceSmi', false, false, 0, SpliceSmi, CopySetup),
+  new Benchmark('SpliceDouble', false, false, 0, SpliceDouble, CopySetup),
+  new Benchmark('SpliceObject', false, false, 0, SpliceObject, CopySetup),
+  new Benchmark('SpliceHoley', false, false, 0, SpliceHoley, CopySetup),
+  new Benchmark('ConcatSmi', false, false, 0, ConcatSmi, CopySetup),
+  new Benchmark('ConcatDouble', false, false, 0, ConcatDouble, CopySetup),
+  new Benchmark('ConcatObject', false, false, 0, ConcatObject, CopySetup),
+  new Benchmark('ConcatHoley', false, false, 0, ConcatHoley, CopySetup),
+]);
+
+var COPY_LENGTH = 1000;
+var smis;
+var doubles;
+var objects;
+var holey;
+
+// ----------------------------------------------------------------------------
+
+function CopySetup() {
+  smis = [];
+  doubles = [];
+  objects = [];
+  holey = [];
+  for (var i = 0; i < COPY_LENGTH; i++) {
+    smis.push(i);
+    doubles.push(i + 0.5);
+    objects.push({ value: i });
+    if (i % 3) holey[i] = i;
+  }
+  holey.length = COPY_LENGTH;
+}
+
+function CheckLength(array, name) {
+  if (array.length != COPY_LENGTH) throw new Error(name);
+}
+
+function SliceSmi() {
+  var copy = smis.slice();
+  copy[0] = -1;
+  CheckLength(copy, "SliceSmi");
+  CheckLength(smis.slice(1, -1).concat(0, 0), "SliceSmi");
+}
+
+function SliceDouble() {
+  var copy = doubles.slice();
+  copy[0] = -1.5;
+  CheckLength(copy, "SliceDouble");
+  CheckLength(doubles.slice(1, -1).concat(0.5, 0.5), "SliceDouble");
+}
+
+function SliceObject() {
+  var copy = objects.slice();
+  copy[0] = null;
+  CheckLength(copy, "SliceObject");
+  CheckLength(objects.slice(1, -1).concat(null, null), "SliceObject");
+}
+
+function SliceHoley() {
+  CheckLength(holey.slice(), "SliceHoley");
+  CheckLength(holey.slice(1, -1).concat(0, 0), "SliceHoley");
+}
+
+// Every splice removes elements from the middle and puts them back, so the
+// arrays keep their length and elements kind across iterations.
+function SpliceSmi() {
+  var removed = smis.splice(10, 100);
+  smis.splice.apply(smis, [500, 0].concat(removed));
+  CheckLength(smis, "SpliceSmi");
+}
+
+function SpliceDouble() {
+  var removed = doubles.splice(10, 100);
+  doubles.splice.apply(doubles, [500, 0].concat(removed));
+  CheckLength(doubles, "SpliceDouble");
+}
+
+function SpliceObject() {
+  var removed = objects.splice(10, 100);
+  objects.splice.apply(objects, [500, 0].concat(removed));
+  CheckLength(objects, "SpliceObject");
+}
+
+function SpliceHoley() {
+  var removed = holey.splice(10, 100);
+  holey.splice.apply(holey, [500, 0].concat(removed));
+  CheckLength(holey, "SpliceHoley");
+}
+
+function ConcatSmi() {
+  if (smis.concat(smis).length != 2 * COPY_LENGTH) {
+    throw new Error("ConcatSmi");
+  }
+}
+
+function ConcatDouble() {
+  if (doubles.concat(doubles).length != 2 * COPY_LENGTH) {
+    throw new Error("ConcatDouble");
+  }
+}
+
+function ConcatObject() {
+  if (objects.concat(objects).length != 2 * COPY_LENGTH) {
+    throw new Error("ConcatObject");
+  }
+}
+
+function ConcatHoley() {
+  if (holey.concat(holey).length != 2 * COPY_LENGTH) {
+    throw new Error("ConcatHoley");
+  }
+}
@@ -0,0 +1,49 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('ArrayIteration', [1000], [
+  new Benchmark('ForEach', false, false, 0, IterateForEach, IterationSetup),
+  new Benchmark('Map', false, false, 0, IterateMap, IterationSetup),
+  new Benchmark('Filter', false, false, 0, IterateFilter, IterationSetup),
+  new Benchmark('Reduce', false, false, 0, IterateReduce, IterationSetup),
+]);
+
+var ITERATION_LENGTH = 1000;
+var records;
+
+// ----------------------------------------------------------------------------
+
+function IterationSetup() {
+  records = [];
+  for (var i = 0; i < ITERATION_LENGTH; i++) {
+    records.push({ id: i, value: i * 0.5 });
+  }
+}
+
+function IterateForEach() {
+  var sum = 0;
+  records.forEach(function(record) { sum += record.value; });
+  if (sum != ITERATION_LENGTH * (ITERATION_LENGTH - 1) / 4) {
+    throw new Error("ForEach");
+  }
+}
+
+function IterateMap() {
+  var ids = records.map(function(record) { return record.id; });
+  if (ids.length != ITERATION_LENGTH) throw new Error("Map");
+}
+
+function IterateFilter() {
+  var even = records.filter(function(record) { return record.id % 2 == 0; });
+  if (even.length != ITERATION_LENGTH / 2) throw new Error("Filter");
+}
+
+function IterateReduce() {
+  var sum = records.reduce(function(sum, record) {
+    return sum + record.id;
+  }, 0);
+  if (sum != ITERATION_LENGTH * (ITERATION_LENGTH - 1) / 2) {
+    throw new Error("Reduce");
+  }
+}
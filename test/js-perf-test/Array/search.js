@@ -0,0 +1,61 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('ArraySearch', [1000], [
+  new Benchmark('IndexOfSmi', false, false, 0, IndexOfSmi, SearchSetup),
+  new Benchmark('IndexOfDouble', false, false, 0, IndexOfDouble, SearchSetup),
+  new Benchmark('IndexOfString', false, false, 0, IndexOfString, SearchSetup),
+  new Benchmark('IncludesSmi', false, false, 0, IncludesSmi, SearchSetup),
+  new Benchmark('IncludesHoley', false, false, 0, IncludesHoley, SearchSetup),
+]);
+
+var SEARCH_LENGTH = 1000;
+var smis;
+var doubles;
+var strings;
+var holey;
+
+// ----------------------------------------------------------------------------
+
+function SearchSetup() {
+  smis = [];
+  doubles = [];
+  strings = [];
+  holey = [];
+  for (var i = 0; i < SEARCH_LENGTH; i++) {
+    smis.push(i);
+    doubles.push(i + 0.5);
+    strings.push("s" + i);
+    if (i % 3) holey[i] = i;
+  }
+}
+
+function IndexOfSmi() {
+  if (smis.indexOf(SEARCH_LENGTH - 1) != SEARCH_LENGTH - 1) {
+    throw new Error("IndexOfSmi");
+  }
+  if (smis.indexOf(-1) != -1) throw new Error("IndexOfSmi");
+}
+
+function IndexOfDouble() {
+  if (doubles.indexOf(SEARCH_LENGTH - 0.5) != SEARCH_LENGTH - 1) {
+    throw new Error("IndexOfDouble");
+  }
+}
+
+function IndexOfString() {
+  if (strings.indexOf("s" + (SEARCH_LENGTH - 1)) != SEARCH_LENGTH - 1) {
+    throw new Error("IndexOfString");
+  }
+}
+
+function IncludesSmi() {
+  if (!smis.includes(SEARCH_LENGTH - 1) || smis.includes(-1)) {
+    throw new Error("IncludesSmi");
+  }
+}
+
+function IncludesHoley() {
+  if (holey.includes(SEARCH_LENGTH * 2)) throw new Error("IncludesHoley");
+}
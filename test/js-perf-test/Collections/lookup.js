@@ -0,0 +1,103 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+
+var MapLookupBenchmark = new BenchmarkSuite('Map-Lookup', [1000], [
+  new Benchmark('Has', false, false, 0, MapLookupHas, LookupSetup,
+      LookupTearDown),
+  new Benchmark('Get', false, false, 0, MapLookupGet, LookupSetup,
+      LookupTearDown),
+]);
+
+
+var WeakMapLookupBenchmark = new BenchmarkSuite('WeakMap-Lookup', [1000], [
+  new Benchmark('Has', false, false, 0, WeakMapLookupHas, LookupSetup,
+      LookupTearDown),
+  new Benchmark('Get', false, false, 0, WeakMapLookupGet, LookupSetup,
+      LookupTearDown),
+]);
+
+
+var WeakSetLookupBenchmark = new BenchmarkSuite('WeakSet-Lookup', [1000], [
+  new Benchmark('Has', false, false, 0, WeakSetLookupHas, LookupSetup,
+      LookupTearDown),
+]);
+
+
+var LOOKUP_N = 1000;
+var lookup_keys;
+var lookup_missing_keys;
+var lookup_map;
+var lookup_weak_map;
+var lookup_weak_set;
+
+
+function LookupSetup() {
+  lookup_keys = new Array(LOOKUP_N);
+  lookup_missing_keys = new Array(LOOKUP_N);
+  lookup_map = new Map;
+  lookup_weak_map = new WeakMap;
+  lookup_weak_set = new WeakSet;
+  for (var i = 0; i < LOOKUP_N; i++) {
+    var key = {};
+    lookup_keys[i] = key;
+    lookup_missing_keys[i] = {};
+    lookup_map.set(key, i);
+    lookup_weak_map.set(key, i);
+    lookup_weak_set.add(key);
+  }
+}
+
+
+function LookupTearDown() {
+  lookup_keys = null;
+  lookup_missing_keys = null;
+  lookup_map = null;
+  lookup_weak_map = null;
+  lookup_weak_set = null;
+}
+
+
+function MapLookupHas() {
+  for (var i = 0; i < LOOKUP_N; i++) {
+    if (!lookup_map.has(lookup_keys[i])) throw new Error();
+    if (lookup_map.has(lookup_missing_keys[i])) throw new Error();
+  }
+}
+
+
+function MapLookupGet() {
+  for (var i = 0; i < LOOKUP_N; i++) {
+    if (lookup_map.get(lookup_keys[i]) !== i) throw new Error();
+    if (lookup_map.get(lookup_missing_keys[i]) !== undefined) {
+      throw new Error();
+    }
+  }
+}
+
+
+function WeakMapLookupHas() {
+  for (var i = 0; i < LOOKUP_N; i++) {
+    if (!lookup_weak_map.has(lookup_keys[i])) throw new Error();
+    if (lookup_weak_map.has(lookup_missing_keys[i])) throw new Error();
+  }
+}
+
+
+function WeakMapLookupGet() {
+  for (var i = 0; i < LOOKUP_N; i++) {
+    if (lookup_weak_map.get(lookup_keys[i]) !== i) throw new Error();
+    if (lookup_weak_map.get(lookup_missing_keys[i]) !== undefined) {
+      throw new Error();
+    }
+  }
+}
+
+
+function WeakSetLookupHas() {
+  for (var i = 0; i < LOOKUP_N; i++) {
+    if (!lookup_weak_set.has(lookup_keys[i])) throw new Error();
+    if (lookup_weak_set.has(lookup_missing_keys[i])) throw new Error();
+  }
+}
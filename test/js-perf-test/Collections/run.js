@@ -9,6 +9,7 @@ load('map.js');
 load('set.js');
 load('weakmap.js');
 load('weakset.js');
+load('lookup.js');
 
 
 var success = true;
@@ -0,0 +1,82 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The payloads resemble API responses: records with short keys, identifiers,
+// numbers, nested objects and some longer text. The reference of each suite
+// is a hundredth of the payload size in bytes, so that the reported score is
+// the throughput in MB/s (bytes per microsecond).
+
+var seed = 42;
+
+function Random(n) {
+  seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+  return seed % n;
+}
+
+var words = ["lorem", "ipsum", "dolor", "sit", "amet", "consectetur",
+             "adipiscing", "elit", "sed", "do", "eiusmod", "tempor",
+             "incididunt", "ut", "labore", "et", "dolore", "magna"];
+
+function Text(count) {
+  var text = [];
+  for (var i = 0; i < count; i++) text.push(words[Random(words.length)]);
+  return text.join(" ");
+}
+
+function Record(i) {
+  return {
+    id: "5f1c" + (1000000 + i).toString(16),
+    index: i,
+    active: Random(2) == 0,
+    balance: Random(1000000) / 100,
+    name: Text(2),
+    email: Text(1) + "@example.com",
+    tags: [Text(1), Text(1), Text(1)],
+    location: { latitude: Random(180000) / 1000 - 90,
+                longitude: Random(360000) / 1000 - 180 },
+    about: Text(40) + ".\n" + Text(20) + " \"" + Text(3) + "\"."
+  };
+}
+
+var records = [];
+for (var i = 0; i < 2000; i++) records.push(Record(i));
+
+var compactPayload = JSON.stringify(records);
+var prettyPayload = JSON.stringify(records, null, 2);
+var stringsPayload = JSON.stringify(records.map(function(r) {
+  return r.about;
+}));
+
+var result;
+
+function ParseCompact() {
+  result = JSON.parse(compactPayload);
+}
+
+function ParsePretty() {
+  result = JSON.parse(prettyPayload);
+}
+
+function ParseStrings() {
+  result = JSON.parse(stringsPayload);
+}
+
+function ParseTearDown() {
+  return result.length == 2000;
+}
+
+new BenchmarkSuite('Parse-Compact', [compactPayload.length / 100], [
+  new Benchmark('Parse-Compact', false, false, 0,
+                ParseCompact, undefined, ParseTearDown),
+]);
+
+new BenchmarkSuite('Parse-Pretty', [prettyPayload.length / 100], [
+  new Benchmark('Parse-Pretty', false, false, 0,
+                ParsePretty, undefined, ParseTearDown),
+]);
+
+new BenchmarkSuite('Parse-Strings', [stringsPayload.length / 100], [
+  new Benchmark('Parse-Strings', false, false, 0,
+                ParseStrings, undefined, ParseTearDown),
+]);
@@ -0,0 +1,22 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Serializes the records from parse.js, which all share a few maps. The
+// reference is a hundredth of the output size in bytes, so that the score is
+// the throughput in MB/s.
+
+var stringifyResult;
+
+function StringifyRecords() {
+  stringifyResult = JSON.stringify(records);
+}
+
+function StringifyTearDown() {
+  return stringifyResult.length == compactPayload.length;
+}
+
+new BenchmarkSuite('Stringify-Records', [compactPayload.length / 100], [
+  new Benchmark('Stringify-Records', false, false, 0,
+                StringifyRecords, undefined, StringifyTearDown),
+]);
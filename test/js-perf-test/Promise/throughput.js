@@ -0,0 +1,57 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('PromiseThroughput', [1000], [
+  new Benchmark('ThenChain', false, false, 0, ThenChain),
+  new Benchmark('ThenFanOut', false, false, 0, ThenFanOut),
+  new Benchmark('ResolveResolved', false, false, 0, ResolveResolved),
+  new Benchmark('RejectCatch', false, false, 0, RejectCatch),
+]);
+
+var HOPS = 100;
+var result;
+
+// ----------------------------------------------------------------------------
+
+function Increment(x) { return x + 1; }
+function Store(x) { result = x; }
+function Rethrow(e) { throw e + 1; }
+
+// Drains the microtask queue and checks the value the last reaction stored.
+function Check(expected, name) {
+  %RunMicrotasks();
+  if (result !== expected) throw new Error(name);
+}
+
+// A chain of reactions, each of which settles the next promise.
+function ThenChain() {
+  var promise = Promise.resolve(0);
+  for (var i = 0; i < HOPS; i++) promise = promise.then(Increment);
+  promise.then(Store);
+  Check(HOPS, "ThenChain");
+}
+
+// Many reactions on a single promise that is resolved later.
+function ThenFanOut() {
+  var resolve;
+  var promise = new Promise(function(r) { resolve = r; });
+  for (var i = 0; i < HOPS; i++) promise.then(Increment);
+  promise.then(Store);
+  resolve(HOPS);
+  Check(HOPS, "ThenFanOut");
+}
+
+// Reactions on promises that are already resolved.
+function ResolveResolved() {
+  for (var i = 0; i < HOPS; i++) Promise.resolve(i).then(Store);
+  Check(HOPS - 1, "ResolveResolved");
+}
+
+// A chain of rejections.
+function RejectCatch() {
+  var promise = Promise.reject(0);
+  for (var i = 0; i < HOPS; i++) promise = promise.then(undefined, Rethrow);
+  promise.catch(Store);
+  Check(HOPS, "RejectCatch");
+}
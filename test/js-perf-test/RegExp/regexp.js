@@ -0,0 +1,71 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Irregexp-generated code on request-routing and log-validation patterns:
+// character classes and ranges, alternations of literals which are checked
+// several characters at a time, and patterns which start with a class, so
+// that the generated code skips ahead with a Boyer-Moore lookahead.
+
+new BenchmarkSuite('RegExp', [1000], [
+  new Benchmark('CharacterClasses', false, false, 0,
+                CharacterClasses, RegExpSetup, RegExpTearDown),
+  new Benchmark('LiteralAlternation', false, false, 0,
+                LiteralAlternation, RegExpSetup, RegExpTearDown),
+  new Benchmark('Lookahead', false, false, 0,
+                Lookahead, RegExpSetup, RegExpTearDown),
+  new Benchmark('TwoByte', false, false, 0,
+                TwoByte, RegExpSetup, RegExpTearDown),
+]);
+
+
+var regexpRequests;
+var regexpLog;
+var regexpLogTwoByte;
+var regexpResult;
+
+function RegExpSetup() {
+  var methods = ["GET", "POST", "PUT", "DELETE"];
+  var requests = [];
+  var lines = [];
+  for (var i = 0; i < 100; i++) {
+    requests.push(methods[i % 4] + " /api/v" + (i % 3 + 1) + "/items/" +
+                  (i * 37 % 1000) + "?sort=name&page=" + (i % 7) +
+                  " HTTP/1.1");
+    lines.push("2016-02-0" + (i % 9 + 1) + "T12:00:" + (10 + i % 50) +
+               "Z host" + (i % 5) + ".example.com status=" +
+               (i % 13 ? 200 : 503) + " latency_ms=" + (i * 7 % 100));
+  }
+  regexpRequests = requests;
+  regexpLog = lines.join("\n");
+  regexpLogTwoByte = regexpLog.replace(/example/g, "\u00e9x\u2026mple");
+  regexpResult = undefined;
+}
+
+function CharacterClasses() {
+  var pattern = /^(GET|POST|PUT|DELETE) \/api\/v[1-3]\/([a-z]+)\/(\d+)\?\w+/;
+  var count = 0;
+  for (var i = 0; i < regexpRequests.length; i++) {
+    if (pattern.test(regexpRequests[i])) count++;
+  }
+  regexpResult = count;
+}
+
+function LiteralAlternation() {
+  var pattern = /status=(?:500|502|503|504)/g;
+  regexpResult = regexpLog.match(pattern).length;
+}
+
+function Lookahead() {
+  var pattern = /[0-9]+ms|latency_ms=9\d/g;
+  regexpResult = regexpLog.replace(pattern, "").length;
+}
+
+function TwoByte() {
+  var pattern = /host[0-9]\.\S+ status=5\d\d/g;
+  regexpResult = regexpLogTwoByte.match(pattern).length;
+}
+
+function RegExpTearDown() {
+  return regexpResult !== undefined;
+}
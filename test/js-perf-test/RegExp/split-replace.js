@@ -0,0 +1,79 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Global split and replace with a function on log lines. Split results are
+// built from the matches without going through exec for each one, and the
+// replace callback gets its arguments without an array per match.
+
+new BenchmarkSuite('SplitReplace', [1000], [
+  new Benchmark('Split', false, false, 0,
+                Split, SplitReplaceSetup, SplitReplaceTearDown),
+  new Benchmark('SplitCaptures', false, false, 0,
+                SplitCaptures, SplitReplaceSetup, SplitReplaceTearDown),
+  new Benchmark('ReplaceFunction', false, false, 0,
+                ReplaceFunction, SplitReplaceSetup, SplitReplaceTearDown),
+  new Benchmark('ReplaceFunctionCaptures', false, false, 0,
+                ReplaceFunctionCaptures, SplitReplaceSetup,
+                SplitReplaceTearDown),
+]);
+
+
+var splitReplaceLines;
+var splitReplaceResult;
+
+function SplitReplaceSetup() {
+  var lines = [];
+  for (var i = 0; i < 100; i++) {
+    lines.push("2016-02-0" + (i % 9 + 1) + "T12:00:" + (10 + i % 50) +
+               "Z,host" + (i % 5) + ".example.com,status=" +
+               (i % 13 ? 200 : 503) + ",latency_ms=" + (i * 7 % 100) +
+               ",path=/api/v" + (i % 3 + 1) + "/items/" + (i * 37 % 1000));
+  }
+  splitReplaceLines = lines;
+  splitReplaceResult = undefined;
+}
+
+function Split() {
+  var pattern = /,/;
+  var count = 0;
+  for (var i = 0; i < splitReplaceLines.length; i++) {
+    count += splitReplaceLines[i].split(pattern).length;
+  }
+  splitReplaceResult = count;
+}
+
+function SplitCaptures() {
+  var pattern = /\s*([,=])\s*/;
+  var count = 0;
+  for (var i = 0; i < splitReplaceLines.length; i++) {
+    count += splitReplaceLines[i].split(pattern, 12).length;
+  }
+  splitReplaceResult = count;
+}
+
+function ReplaceFunction() {
+  var pattern = /\d+/g;
+  var count = 0;
+  for (var i = 0; i < splitReplaceLines.length; i++) {
+    count += splitReplaceLines[i].replace(pattern, function(m, index) {
+      return m.length > 2 ? "N" : m;
+    }).length;
+  }
+  splitReplaceResult = count;
+}
+
+function ReplaceFunctionCaptures() {
+  var pattern = /(\w+)=(\w+)?/g;
+  var count = 0;
+  for (var i = 0; i < splitReplaceLines.length; i++) {
+    count += splitReplaceLines[i].replace(pattern, function(m, key, value) {
+      return value === undefined ? key : value + ":" + key;
+    }).length;
+  }
+  splitReplaceResult = count;
+}
+
+function SplitReplaceTearDown() {
+  return splitReplaceResult !== undefined;
+}
@@ -0,0 +1,61 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Short pattern searches over log-like subjects, where the first character of
+// the pattern is common (spaces, digits, lowercase letters).
+
+new BenchmarkSuite('StringSearch', [1000], [
+  new Benchmark('IndexOfCommonFirstChar', false, false, 0,
+                IndexOfCommonFirstChar, SearchSetup, SearchTearDown),
+  new Benchmark('IndexOfRareFirstChar', false, false, 0,
+                IndexOfRareFirstChar, SearchSetup, SearchTearDown),
+  new Benchmark('IndexOfTwoByte', false, false, 0,
+                IndexOfTwoByte, SearchSetup, SearchTearDown),
+  new Benchmark('IncludesMissing', false, false, 0,
+                IncludesMissing, SearchSetup, SearchTearDown),
+  new Benchmark('SplitLines', false, false, 0,
+                SplitLines, SearchSetup, SearchTearDown),
+]);
+
+
+var searchLog;
+var searchLogTwoByte;
+var searchResult;
+
+function SearchSetup() {
+  var lines = [];
+  for (var i = 0; i < 200; i++) {
+    lines.push("2016-02-0" + (i % 9 + 1) + " 12:00:" + (10 + i % 50) +
+               " info server request handled in " + (i * 7 % 100) +
+               " ms status=200 path=/api/items/" + i);
+  }
+  lines.push("2016-02-09 12:00:59 error server request failed status=500");
+  searchLog = lines.join("\n");
+  searchLogTwoByte = searchLog + "\u2026";
+  searchResult = undefined;
+}
+
+function IndexOfCommonFirstChar() {
+  searchResult = searchLog.indexOf(" error");
+}
+
+function IndexOfRareFirstChar() {
+  searchResult = searchLog.indexOf("=500");
+}
+
+function IndexOfTwoByte() {
+  searchResult = searchLogTwoByte.indexOf(" error");
+}
+
+function IncludesMissing() {
+  searchResult = searchLog.includes("s=404");
+}
+
+function SplitLines() {
+  searchResult = searchLog.split(" ms ").length;
+}
+
+function SearchTearDown() {
+  return searchResult !== undefined;
+}
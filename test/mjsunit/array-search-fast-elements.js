@@ -0,0 +1,103 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// indexOf and includes search fast elements directly for every kind.
+function Check(array, value, index, from) {
+  assertEquals(index, array.indexOf(value, from));
+  assertEquals(index >= 0, array.includes(value, from));
+}
+
+var packed_smi = [1, 2, 3, 2];
+Check(packed_smi, 2, 1);
+Check(packed_smi, 2, 3, 2);
+Check(packed_smi, 2, 3, -1);
+Check(packed_smi, 4, -1);
+Check(packed_smi, "2", -1);
+Check(packed_smi, 2.0, 1);
+Check(packed_smi, 1, -1, 10);
+
+var holey_smi = [1, , 3];
+Check(holey_smi, 3, 2);
+assertEquals(-1, holey_smi.indexOf(undefined));
+assertTrue(holey_smi.includes(undefined));
+assertFalse(holey_smi.includes(undefined, 2));
+
+var packed_double = [1.5, -0, NaN, 2];
+Check(packed_double, 1.5, 0);
+Check(packed_double, 2, 3);
+Check(packed_double, 0, 1);
+assertEquals(-1, packed_double.indexOf(NaN));
+assertTrue(packed_double.includes(NaN));
+Check(packed_double, "1.5", -1);
+assertFalse(packed_double.includes(undefined));
+
+var holey_double = [1.5, , 2.5];
+Check(holey_double, 2.5, 2);
+assertEquals(-1, holey_double.indexOf(undefined));
+assertTrue(holey_double.includes(undefined));
+
+var objects = [{}, "abc", 1.5, NaN, null, -0];
+Check(objects, objects[0], 0);
+Check(objects, {}, -1);
+Check(objects, "ab" + "c", 1);
+Check(objects, 1.5, 2);
+Check(objects, null, 4);
+Check(objects, 0, 5);
+assertEquals(-1, objects.indexOf(NaN));
+assertTrue(objects.includes(NaN));
+assertFalse(objects.includes(undefined));
+
+var holey_objects = ["a", , "c"];
+Check(holey_objects, "c", 2);
+assertEquals(-1, holey_objects.indexOf(undefined));
+assertTrue(holey_objects.includes(undefined));
+
+// Holes read through to prototypes with elements.
+var proto = [];
+proto[1] = "p";
+var inherits = ["a", , "c"];
+Object.setPrototypeOf(inherits, proto);
+Check(inherits, "p", 1);
+Array.prototype[1] = "q";
+Check(["a", , "c"], "q", 1);
+Check(["a", "b", "c"], "q", -1);
+delete Array.prototype[1];
+Check(["a", , "c"], "q", -1);
+
+// The start index conversion may shrink the array.
+var shrinking = [1, 2, 3, 4];
+var from = { valueOf: function() { shrinking.length = 1; return 0; } };
+assertEquals(-1, shrinking.indexOf(4, from));
+shrinking = [1, 2, 3, 4];
+assertTrue(shrinking.includes(undefined, from));
+
+// Optimized callers.
+function IndexOf(a, v) { return a.indexOf(v); }
+function Includes(a, v) { return a.includes(v); }
+for (var i = 0; i < 3; i++) {
+  assertEquals(2, IndexOf([1, 2, 3], 3));
+  assertTrue(Includes([1.5, 2.5], 2.5));
+  assertFalse(Includes(["x"], "y"));
+  if (i == 1) {
+    %OptimizeFunctionOnNextCall(IndexOf);
+    %OptimizeFunctionOnNextCall(Includes);
+  }
+}
+
+// Callback-based builtins see the same elements.
+function Sum(a) {
+  var sum = 0;
+  a.forEach(function(x) { sum += x; });
+  return sum + a.map(function(x) { return x; }).length +
+         a.filter(function(x) { return x > 1; }).length +
+         a.reduce(function(x, y) { return x + y; });
+}
+for (var i = 0; i < 3; i++) {
+  assertEquals(6 + 3 + 2 + 6, Sum([1, 2, 3]));
+  assertEquals(5 + 3 + 2 + 5, Sum([2, , 3]));
+  assertEquals(5 + 2 + 2 + 5, Sum([2.5, 2.5]));
+  if (i == 1) %OptimizeFunctionOnNextCall(Sum);
+}
@@ -0,0 +1,110 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Slices of whole packed arrays share the backing store with the receiver
+// until either of them is written to.
+
+function MakeArray(length, value) {
+  var array = [];
+  for (var i = 0; i < length; i++) array.push(value(i));
+  return array;
+}
+
+var kinds = [
+  function(i) { return i; },
+  function(i) { return i + 0.5; },
+  function(i) { return { value: i }; },
+  function(i) { return "s" + i; },
+];
+
+for (var k = 0; k < kinds.length; k++) {
+  var value = kinds[k];
+  var array = MakeArray(100, value);
+  var copy = array.slice();
+  assertEquals(array, copy);
+  assertTrue(%HasFastPackedElements(copy));
+
+  copy[0] = "copy";
+  assertEquals(value(0), array[0]);
+  array[1] = "array";
+  assertEquals(value(1), copy[1]);
+
+  copy.push("pushed");
+  assertEquals(100, array.length);
+  assertEquals(101, copy.length);
+  array.length = 10;
+  assertEquals(101, copy.length);
+  assertEquals(value(99), copy[99]);
+
+  var second = array.slice(0);
+  var third = second.slice(0, second.length);
+  second.pop();
+  third.shift();
+  assertEquals(10, array.length);
+  assertEquals(9, second.length);
+  assertEquals(9, third.length);
+  assertEquals(value(2), third[1]);
+  assertEquals("array", array[1]);
+}
+
+// Writes through every kind of store copy the shared backing store.
+var array = MakeArray(50, function(i) { return i; });
+var copy = array.slice();
+array.splice(0, 10);
+assertEquals(40, array.length);
+assertEquals(50, copy.length);
+assertEquals(0, copy[0]);
+copy.reverse();
+assertEquals(10, array[0]);
+assertEquals(49, copy[0]);
+copy = array.slice();
+array.sort(function(a, b) { return b - a; });
+assertEquals(10, copy[0]);
+assertEquals(49, array[0]);
+copy = array.slice();
+array.fill(7);
+assertEquals(49, copy[0]);
+copy = array.slice();
+array.unshift(1, 2);
+assertEquals(7, copy[0]);
+assertEquals(1, array[0]);
+copy = array.slice();
+Object.defineProperty(array, 0, { value: 5 });
+assertEquals(1, copy[0]);
+copy = array.slice();
+Object.freeze(array);
+copy[0] = 9;
+assertEquals(5, array[0]);
+
+// Splice and concat move elements in bulk for all kinds.
+var holey = [];
+for (var i = 0; i < 100; i++) {
+  if (i % 3) holey[i] = i;
+}
+for (var k = 0; k < kinds.length; k++) {
+  var value = kinds[k];
+  var array = MakeArray(100, value);
+  var removed = array.splice(10, 20, "a", "b");
+  assertEquals(20, removed.length);
+  assertEquals(value(10), removed[0]);
+  assertEquals(value(29), removed[19]);
+  assertEquals(82, array.length);
+  assertEquals("b", array[11]);
+  assertEquals(value(30), array[12]);
+  array.splice(50, 0, value(1), value(2), value(3));
+  assertEquals(85, array.length);
+  assertEquals(value(3), array[52]);
+  assertEquals(value(68), array[53]);
+  var both = array.concat(removed);
+  assertEquals(105, both.length);
+  assertEquals(value(10), both[85]);
+}
+var removed = holey.splice(1, 10);
+assertEquals(10, removed.length);
+assertFalse(2 in removed);
+assertEquals(89, holey.length);
+assertFalse(2 in holey);
+assertEquals(13, holey[3]);
@@ -0,0 +1,47 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Dictionary-mode objects used as caches keyed by computed strings.
+var cache = {};
+for (var i = 0; i < 200; i++) {
+  cache["key" + i] = i;
+}
+delete cache.key0;
+assertFalse(%HasFastProperties(cache));
+
+function Get(o, prefix, i) {
+  return o[prefix + i];
+}
+
+for (var i = 1; i < 200; i++) {
+  assertEquals(i, Get(cache, "key", i));
+  assertTrue(("k" + "ey" + i) in cache);
+}
+assertEquals(undefined, Get(cache, "key", 0));
+assertEquals(undefined, Get(cache, "missing", 1));
+assertEquals(undefined, Get(cache, "never-internalized-", Math.random()));
+assertFalse(("x" + Math.random()) in cache);
+
+// Deleted entries leave holes that are probed past.
+for (var i = 1; i < 200; i += 2) {
+  assertTrue(delete cache["key" + i]);
+}
+for (var i = 1; i < 200; i++) {
+  assertEquals(i % 2 ? undefined : i, Get(cache, "key", i));
+}
+for (var i = 1; i < 200; i += 2) {
+  cache["key" + i] = -i;
+}
+for (var i = 1; i < 200; i++) {
+  assertEquals(i % 2 ? -i : i, Get(cache, "key", i));
+}
+
+// Symbols and strings with the same description do not collide.
+var sym = Symbol("key2");
+cache[sym] = "symbol";
+assertEquals("symbol", cache[sym]);
+assertEquals(2, Get(cache, "key", 2));
+assertEquals(undefined, cache[Symbol("key2")]);
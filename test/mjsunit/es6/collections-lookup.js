@@ -0,0 +1,78 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --expose-gc
+
+// WeakMap and WeakSet lookups probe the backing store from JavaScript.
+function TestWeakLookup(keys, absent) {
+  var wm = new WeakMap;
+  var ws = new WeakSet;
+  for (var i = 0; i < keys.length; i++) {
+    wm.set(keys[i], i);
+    ws.add(keys[i]);
+  }
+
+  function Get(key) { return wm.get(key); }
+  function HasMap(key) { return wm.has(key); }
+  function HasSet(key) { return ws.has(key); }
+
+  function Check() {
+    for (var i = 0; i < keys.length; i++) {
+      var expected = i % 3 == 0 ? undefined : i;
+      assertEquals(expected, Get(keys[i]));
+      assertEquals(expected !== undefined, HasMap(keys[i]));
+      assertEquals(expected !== undefined, HasSet(keys[i]));
+    }
+    for (var i = 0; i < absent.length; i++) {
+      assertEquals(undefined, Get(absent[i]));
+      assertFalse(HasMap(absent[i]));
+      assertFalse(HasSet(absent[i]));
+    }
+    assertEquals(undefined, Get(1));
+    assertFalse(HasMap("key"));
+    assertFalse(HasSet(Symbol()));
+  }
+
+  // Deleted entries stay in the probe chains of the remaining keys.
+  for (var i = 0; i < keys.length; i += 3) {
+    assertTrue(wm.delete(keys[i]));
+    assertTrue(ws.delete(keys[i]));
+  }
+  Check();
+  Check();
+  %OptimizeFunctionOnNextCall(Get);
+  %OptimizeFunctionOnNextCall(HasMap);
+  %OptimizeFunctionOnNextCall(HasSet);
+  Check();
+  gc();
+  Check();
+}
+
+function MakeKeys(n) {
+  var keys = [];
+  for (var i = 0; i < n; i++) keys.push(i % 2 ? {} : function() {});
+  return keys;
+}
+
+TestWeakLookup(MakeKeys(3), MakeKeys(2));
+TestWeakLookup(MakeKeys(200), MakeKeys(50));
+
+// Proxies and global proxies are keyed through their generic hash.
+var proxy = new Proxy({}, {});
+var wm = new WeakMap([[proxy, 1], [this, 2]]);
+assertEquals(1, wm.get(proxy));
+assertEquals(2, wm.get(this));
+assertFalse(wm.has(new Proxy({}, {})));
+
+// Map lookups of keys that were never hashed find nothing.
+function MapLookup(map, key) { return map.has(key) || map.delete(key); }
+var map = new Map([[{}, 1], ["a", 2], [1.5, 3]]);
+for (var i = 0; i < 3; i++) {
+  assertFalse(MapLookup(map, {}));
+  assertFalse(MapLookup(map, 2.5));
+  assertTrue(MapLookup(map, 1.5));
+  if (i == 1) %OptimizeFunctionOnNextCall(MapLookup);
+}
+assertEquals(3, map.size);
+assertTrue(map.has("a"));
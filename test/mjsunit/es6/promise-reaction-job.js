@@ -0,0 +1,43 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Reactions of settled promises are queued as data rather than closures, and
+// still run in order with the other microtasks.
+
+var log = [];
+function Log(tag) {
+  return function(x) { log.push(tag + x); return x; };
+}
+
+var resolve;
+var pending = new Promise(function(r) { resolve = r; });
+pending.then(Log("a"));
+pending.then(Log("b")).then(Log("c"));
+Promise.resolve(1).then(Log("d"));
+Promise.reject(2).catch(Log("e"));
+resolve(3);
+var thenable = { then: function(f) { log.push("t"); f(4); } };
+Promise.resolve(thenable).then(Log("f"));
+assertEquals([], log);
+%RunMicrotasks();
+assertEquals(["d1", "e2", "a3", "b3", "t", "c3", "f4"], log);
+
+// A throwing handler rejects the derived promise only.
+log = [];
+var p = Promise.resolve(5);
+p.then(function() { throw 6; }).catch(Log("g"));
+p.then(Log("h"));
+%RunMicrotasks();
+assertEquals(["h5", "g6"], log);
+
+// Promises from other contexts queue their reactions in their own context.
+var realm = Realm.create();
+var other = Realm.eval(realm, "Promise.resolve(7)");
+log = [];
+other.then(Log("i"));
+Realm.eval(realm, "Promise").prototype.then.call(other, Log("j"));
+%RunMicrotasks();
+assertEquals(["i7", "j7"], log);
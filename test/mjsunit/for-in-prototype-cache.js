@@ -0,0 +1,78 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --expose-gc
+
+// Keys enumerated over receivers whose prototypes have enumerable properties
+// are reused across loops, and must follow changes to the prototype chain.
+function Keys(o) {
+  var keys = [];
+  for (var k in o) keys.push(k);
+  return keys.join();
+}
+
+function Base() { this.a = 1; this.b = 2; }
+Base.prototype.p = 3;
+Base.prototype.q = 4;
+
+var o1 = new Base();
+var o2 = new Base();
+assertEquals("a,b,p,q", Keys(o1));
+assertEquals("a,b,p,q", Keys(o2));
+assertEquals("a,b,p,q", Keys(o1));
+
+// Adding, removing and reconfiguring prototype properties.
+Base.prototype.r = 5;
+assertEquals("a,b,p,q,r", Keys(o1));
+delete Base.prototype.p;
+assertEquals("a,b,q,r", Keys(o2));
+Object.defineProperty(Base.prototype, "q", {enumerable: false});
+assertEquals("a,b,r", Keys(o1));
+
+// Shadowed prototype properties are enumerated once.
+o1.r = 6;
+assertEquals("a,b,r", Keys(o1));
+assertEquals("a,b,r", Keys(o2));
+
+// Elements on the receiver or a prototype do not change the map.
+o2[0] = 0;
+assertEquals("0,a,b,r", Keys(o2));
+Base.prototype[1] = 1;
+assertEquals("a,b,1,r", Keys(new Base()));
+assertEquals("0,a,b,1,r", Keys(o2));
+delete Base.prototype[1];
+
+// Properties further up the chain.
+Object.prototype.z = 7;
+assertEquals("a,b,r,z", Keys(new Base()));
+delete Object.prototype.z;
+assertEquals("a,b,r", Keys(new Base()));
+
+// Replacing the prototype.
+var o3 = new Base();
+Object.setPrototypeOf(o3, {s: 8});
+assertEquals("a,b,s", Keys(o3));
+assertEquals("a,b,r", Keys(new Base()));
+
+// Deleting a prototype property during the loop skips it.
+function Derived() { this.x = 1; }
+Derived.prototype = {y: 2, z: 3};
+var d = new Derived();
+assertEquals("x,y,z", Keys(d));
+var seen = [];
+for (var k in d) {
+  seen.push(k);
+  if (k == "x") delete Derived.prototype.z;
+}
+assertEquals("x,y", seen.join());
+assertEquals("x,y", Keys(d));
+
+// Optimized loops and garbage collection.
+Derived.prototype.w = 4;
+for (var i = 0; i < 3; i++) {
+  assertEquals("x,y,w", Keys(new Derived()));
+  if (i == 1) %OptimizeFunctionOnNextCall(Keys);
+}
+gc();
+assertEquals("x,y,w", Keys(new Derived()));
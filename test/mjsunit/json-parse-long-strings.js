@@ -0,0 +1,34 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Strings and whitespace in one-byte JSON sources are skipped in blocks;
+// check that escapes, control characters and the end of the input are still
+// found at every offset within a block.
+
+var plain = "abcdefghijklmnopqrstuvwxyz0123456789 !#$%&'()*+,-./:;<=>?@[]^_`{|}~";
+for (var i = 0; i < plain.length; i++) {
+  var prefix = plain.substring(0, i);
+  assertEquals(prefix, JSON.parse('"' + prefix + '"'));
+  assertEquals(prefix + '"x', JSON.parse('"' + prefix + '\\"x"'));
+  assertEquals(prefix + "\n", JSON.parse('"' + prefix + '\\n"'));
+  assertEquals(prefix + "\xe9", JSON.parse('"' + prefix + '\xe9"'));
+  assertThrows(function() { JSON.parse('"' + prefix + '\x01"'); },
+               SyntaxError);
+  assertThrows(function() { JSON.parse('"' + prefix); }, SyntaxError);
+
+  // Keys are looked up in the string table.
+  var key = "k" + prefix;
+  var object = JSON.parse('{"' + key + '":1}');
+  assertEquals([key], Object.keys(object));
+  object = JSON.parse('{"' + key + '\\t":1}');
+  assertEquals([key + "\t"], Object.keys(object));
+  assertThrows(function() { JSON.parse('{"' + key); }, SyntaxError);
+
+  var spaces = new Array(i + 1).join(" ");
+  assertEquals([1, 2], JSON.parse(spaces + "[" + spaces + "1," + spaces +
+                                  "\n\t2" + spaces + "]" + spaces));
+}
+
+var pretty = JSON.stringify({a: [1, {b: "c"}], d: {e: null}}, null, 16);
+assertEquals({a: [1, {b: "c"}], d: {e: null}}, JSON.parse(pretty));
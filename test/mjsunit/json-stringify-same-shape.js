@@ -0,0 +1,64 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Objects sharing a map reuse the escaped keys of the first one serialized.
+
+function Point(x, y) {
+  this.x = x;
+  this.y = y;
+  this["needs\"escape\n"] = true;
+  this["ä"] = null;
+  this["€"] = "euro";
+}
+
+var points = [];
+for (var i = 0; i < 100; i++) points.push(new Point(i, i + 0.5));
+var expected = points.map(function(p) {
+  return '{"x":' + p.x + ',"y":' + p.y +
+         ',"needs\\"escape\\n":true,"ä":null,"€":"euro"}';
+});
+assertEquals("[" + expected.join(",") + "]", JSON.stringify(points));
+
+// Non-enumerable and symbol-keyed properties are skipped.
+var hidden = [{a: 1}, {a: 2}];
+hidden.forEach(function(o) {
+  Object.defineProperty(o, "b", {value: 1, enumerable: false});
+  o[Symbol("c")] = 3;
+  o.d = undefined;
+  o.e = 4;
+});
+assertEquals('[{"a":1,"e":4},{"a":2,"e":4}]', JSON.stringify(hidden));
+
+// Accessors are called for every object.
+var count = 0;
+var withAccessors = [{}, {}, {}].map(function(o) {
+  Object.defineProperty(o, "get", {
+    get: function() { return ++count; },
+    enumerable: true
+  });
+  o.plain = "p";
+  return o;
+});
+assertEquals('[{"get":1,"plain":"p"},{"get":2,"plain":"p"},' +
+             '{"get":3,"plain":"p"}]', JSON.stringify(withAccessors));
+
+// A toJSON method may change the shape of the object being serialized.
+var shrinking = [];
+for (var i = 0; i < 3; i++) {
+  var o = {first: null, second: 2, third: 3};
+  o.first = {
+    parent: o,
+    toJSON: function() { delete this.parent.second; return 1; }
+  };
+  shrinking.push(o);
+}
+assertEquals('[{"first":1,"third":3},{"first":1,"third":3},' +
+             '{"first":1,"third":3}]', JSON.stringify(shrinking));
+
+// Double fields.
+var doubles = [];
+for (var i = 0; i < 10; i++) doubles.push({d: i + 0.25, n: NaN, s: "s"});
+assertEquals(JSON.stringify(doubles.map(function(o) {
+  return {d: o.d, n: null, s: o.s};
+})), JSON.stringify(doubles));
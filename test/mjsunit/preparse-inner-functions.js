@@ -0,0 +1,57 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --preparse-inner-functions --allow-natives-syntax
+
+// Inner function declarations are skipped when the enclosing function is
+// parsed again for optimization; the variables they reference must still be
+// allocated in the context.
+
+function outer(x) {
+  var counter = 0;
+  var unused = 1;
+  function increment() { counter++; return counter; }
+  function read() { return counter + x; }
+  function shadow() { var counter = 100; return counter; }
+  function nested() {
+    function deeper() { return x * 2; }
+    return deeper();
+  }
+  increment();
+  return [increment(), read(), shadow(), nested(), unused];
+}
+
+assertEquals([2, 12, 100, 20, 1], outer(10));
+assertEquals([2, 12, 100, 20, 1], outer(10));
+%OptimizeFunctionOnNextCall(outer);
+assertEquals([2, 7, 100, 10, 1], outer(5));
+assertEquals([2, 7, 100, 10, 1], outer(5));
+
+
+function closures() {
+  var value = "a";
+  function get() { return value; }
+  function set(v) { value = v; }
+  return { get: get, set: set };
+}
+
+var pair = closures();
+pair.set("b");
+assertEquals("b", pair.get());
+%OptimizeFunctionOnNextCall(closures);
+pair = closures();
+assertEquals("a", pair.get());
+pair.set("c");
+assertEquals("c", pair.get());
+
+
+function strictInner() {
+  var y = 3;
+  function g() { "use strict"; return typeof this + y; }
+  return g();
+}
+
+assertEquals("undefined3", strictInner());
+%OptimizeFunctionOnNextCall(strictInner);
+assertEquals("undefined3", strictInner());
@@ -0,0 +1,49 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-linear-fallback
+
+// Patterns with nested unbounded quantifiers are matched in linear time.
+var long_a = "a".repeat(50000);
+assertNull(/(a+)+b/.exec(long_a));
+assertNull(/(a*)*b/.exec(long_a));
+assertNull(/^(\w+\s?)*$/.exec("foo bar ".repeat(5000) + "!"));
+assertFalse(/(x+x+)+y/.test("x".repeat(10000)));
+assertEquals(["aaab", "aaa"], /(a+)+b/.exec("xaaab"));
+
+// They agree with the backtracking engines on the match and captures.
+assertEquals(["aaa", "a"], /(?:(a|ab)+)*/.exec("aaab"));
+assertEquals(["aa", "a"], /(?:(a)*?)*/.exec("aa"));
+assertEquals(["abab", undefined, "b"], /(?:(a)|(b)+)+/.exec("abab"));
+assertEquals(["ab", "a", undefined], /(?:(a)|(b)*)+?b/.exec("ab"));
+assertEquals(["aa", "a"], /(?:(a+?)+?)+a/.exec("aa"));
+assertEquals(["bb", "bb"], /((?:b*?)+)/.exec("bb"));
+assertEquals(["  bb", "  bb"], /((?:[ b]*)*)/.exec("  bb"));
+
+// Assertions, classes and flags.
+assertEquals(["ab cd", "cd"], /\b(\w+ ?)+$/.exec("ab cd"));
+assertEquals(["B", "B"], /([^a]+)+$/.exec("aB"));
+assertEquals(["AbA", "A"], /(?:(a)+b*)+/i.exec("xAbA"));
+assertEquals(["cd", "cd"], /^(\w+)+$/m.exec("ab!\ncd"));
+assertNull(/(a+)+$/y.exec("ba"));
+var sticky = /(a+)+/y;
+sticky.lastIndex = 1;
+assertEquals(["aa", "aa"], sticky.exec("baa"));
+assertEquals(3, sticky.lastIndex);
+
+// Global replace, split and match go through the same engine.
+assertEquals("x-x-x", "aa-a-aaa".replace(/(a+)+/g, "x"));
+assertEquals(["", "-", "-", ""], "aa-a-aaa".split(/(?:a+)+/));
+assertEquals(["aa", "a", "aaa"], "aa-a-aaa".match(/(a+)+/g));
+assertEquals("[aa][a]", "aa-a".replace(/(a+)+|-/g, function(m, p) {
+  return p ? "[" + m + "]" : "";
+}));
+
+// Two-byte subjects.
+assertEquals(["\u20ac\u20aca", "\u20ac\u20aca"],
+             /([\u20ac-\u20ff]+a)+/.exec("x\u20ac\u20aca"));
+
+// Backreferences and lookarounds are left to the backtracking engines.
+assertEquals(["aa", "a"], /(a+)+\1/.exec("aa"));
+assertEquals(["a", "a"], /(a+)+(?=b)/.exec("ab"));
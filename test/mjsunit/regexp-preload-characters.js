@@ -0,0 +1,29 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The generated code may load and check several characters at once, from
+// any offset in the subject. The first character must end up in the least
+// significant bits on both little- and big-endian targets.
+
+var patterns = [/abcd|abce/, /ab|ba/, /x[0-9]yz/, /(?:GET|PUT) \//];
+var matches = ["abce", "ba", "x7yz", "PUT /"];
+var misses = ["abcf", "aa", "x7zy", "POT /"];
+
+for (var p = 0; p < patterns.length; p++) {
+  for (var offset = 0; offset < 9; offset++) {
+    var prefix = "-".repeat(offset);
+    assertEquals(offset, (prefix + matches[p] + "--").search(patterns[p]));
+    assertEquals(-1, (prefix + misses[p] + "--").search(patterns[p]));
+    // Two-byte subjects.
+    var two_byte = "…" + prefix;
+    assertEquals(offset + 1,
+                 (two_byte + matches[p] + "--").search(patterns[p]));
+    assertEquals(-1, (two_byte + misses[p] + "--").search(patterns[p]));
+  }
+}
+
+// Matches which end at the end of the subject.
+assertTrue(/abcd|abce/.test("--abce"));
+assertFalse(/abcd|abce/.test("--abc"));
+assertTrue(/…a|…b/.test("xy…b"));
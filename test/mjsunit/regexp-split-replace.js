@@ -0,0 +1,71 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Split with a regexp collects all parts at once, and replace with a function
+// passes the captures of each match to the callback without an array.
+
+assertEquals(["a", "b", "c"], "a,b,c".split(/,/));
+assertEquals(["a", "b"], "a,b,c".split(/,/, 2));
+assertEquals([], "a,b,c".split(/,/, 0));
+assertEquals(["a", ",", "b", ",", "c"], "a,b,c".split(/(,)/));
+assertEquals(["a", ","], "a,b,c".split(/(,)/, 2));
+assertEquals(["a", undefined, "-", "b", ";", undefined, "c"],
+             "a-b;c".split(/(;)|(-)/));
+assertEquals(["", "a", ""], ",a,".split(/,/));
+
+// Zero-length matches split between characters, but not at the start or the
+// end of the subject.
+assertEquals(["a", "b", "c"], "abc".split(/(?:)/));
+assertEquals(["a", "b", "c"], "abc".split(/x*/));
+assertEquals(["a", "", "b", "", "c"], "abc".split(/(x*)/));
+assertEquals(["\ud83d", "\ude00"], "\ud83d\ude00".split(/(?:)/));
+assertEquals(["\ud83d\ude00", "\u20ac"], "\ud83d\ude00\u20ac".split(/(?:)/u));
+
+// Sticky regexps only match at the current position.
+assertEquals(["", "b", "c"], ",b,c".split(/,/y));
+
+// The last match reflects the last successful match.
+"a1b22c".split(/(\d+)/);
+assertEquals("22", RegExp.lastMatch);
+assertEquals("22", RegExp.$1);
+assertEquals("a1b", RegExp.leftContext);
+"a1b22c".split(/\d/, 2);
+assertEquals("2", RegExp.lastMatch);
+assertEquals("a1b", RegExp.leftContext);
+
+// Long subjects produce slices of the subject.
+var long = "abcdefghij,".repeat(1000);
+var parts = long.split(/,/);
+assertEquals(1001, parts.length);
+assertEquals("abcdefghij", parts[999]);
+assertEquals("", parts[1000]);
+
+// Replace with a function gets the match, the captures, the index and the
+// subject.
+var calls = [];
+assertEquals("[a1]-[b]-c", "a1-b-c".replace(/(\w)(\d)?(?=-)/g,
+    function(m, c1, c2, index, subject) {
+      calls.push([m, c1, c2, index, subject]);
+      return "[" + m + "]";
+    }));
+assertEquals([["a1", "a", "1", 0, "a1-b-c"],
+              ["b", "b", undefined, 3, "a1-b-c"]], calls);
+assertEquals("x=1;y=2", "1=x;2=y".replace(/(\d)=(\w)/g, function(m, a, b) {
+  return b + "=" + a;
+}));
+
+// Replacements can be any length, and callbacks may use regexps themselves.
+assertEquals("A-B", "aa-bb".replace(/(\w)\1/g, function(m, c) {
+  return c.replace(/./g, function(x) { return x.toUpperCase(); });
+}));
+var long_replaced = long.replace(/(\w)j/g, function(m, c) { return c; });
+assertEquals("abcdefghi,".repeat(1000), long_replaced);
+assertEquals(long_replaced, long.replace(/(\w)j/g, function(m, c) {
+  return c;
+}));
+
+// The matches fill the builder exactly, leaving no room for the tail.
+assertEquals("x[ab][ab][ab]y", "xabababy".replace(/(a)(b)/g, function(m) {
+  return "[" + m + "]";
+}));
@@ -0,0 +1,79 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Short patterns whose first character is common in the subject are searched
+// by comparing the first and last characters a word at a time.
+
+function NaiveIndexOf(subject, pattern, start) {
+  outer: for (var i = start; i <= subject.length - pattern.length; i++) {
+    for (var j = 0; j < pattern.length; j++) {
+      if (subject.charCodeAt(i + j) != pattern.charCodeAt(j)) continue outer;
+    }
+    return i;
+  }
+  return -1;
+}
+
+function Check(subject, pattern) {
+  for (var start = 0; start <= subject.length; start += 7) {
+    assertEquals(NaiveIndexOf(subject, pattern, start),
+                 subject.indexOf(pattern, start),
+                 pattern + " from " + start);
+  }
+}
+
+var seed = 17;
+function Random(n) {
+  seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+  return seed % n;
+}
+
+function RandomString(alphabet, length) {
+  var chars = [];
+  for (var i = 0; i < length; i++) {
+    chars.push(alphabet[Random(alphabet.length)]);
+  }
+  return chars.join("");
+}
+
+var alphabets = [
+  ["a", "b"],
+  ["a", "a", "a", "b", " "],
+  ["a", "ä", "b"],
+  ["a", "€", "b", "š"],
+];
+
+for (var a = 0; a < alphabets.length; a++) {
+  var alphabet = alphabets[a];
+  var subject = RandomString(alphabet, 500);
+  for (var length = 2; length <= 6; length++) {
+    for (var k = 0; k < 10; k++) {
+      Check(subject, RandomString(alphabet, length));
+      // A pattern that occurs, taken from the subject.
+      var start = Random(subject.length - length);
+      Check(subject, subject.substring(start, start + length));
+    }
+  }
+}
+
+// Matches at every offset from the end, past the last full word.
+var filler = "x".repeat(200);
+for (var tail = 0; tail < 20; tail++) {
+  var subject = filler + "abc" + "y".repeat(tail);
+  assertEquals(200, subject.indexOf("abc"));
+  assertEquals(200, subject.indexOf("xabc") + 1);
+  assertEquals(-1, subject.indexOf("abd"));
+  var two_byte = "€" + subject;
+  assertEquals(201, two_byte.indexOf("abc"));
+  assertEquals(-1, two_byte.indexOf("ab€"));
+}
+
+// Patterns with characters outside of Latin1 never occur in one-byte strings.
+assertEquals(-1, "aäbc".repeat(100).indexOf("a€"));
+
+// split and includes share the search.
+var line = "key=value; ".repeat(100);
+assertEquals(101, line.split("; ").length);
+assertTrue(line.includes("e; k"));
+assertFalse(line.includes("e;;k"));
@@ -0,0 +1,74 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Searching and comparing cons strings without flattening them.
+
+function NaiveIndexOf(subject, pattern) {
+  outer: for (var i = 0; i <= subject.length - pattern.length; i++) {
+    for (var j = 0; j < pattern.length; j++) {
+      if (subject.charCodeAt(i + j) != pattern.charCodeAt(j)) continue outer;
+    }
+    return i;
+  }
+  return -1;
+}
+
+var seed = 23;
+function Random(n) {
+  seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+  return seed % n;
+}
+
+// Builds a rope from pieces of random length, appending or prepending each,
+// and a flat string with the same characters.
+function Rope(alphabet, count) {
+  var rope = "";
+  var pieces = [];
+  for (var i = 0; i < count; i++) {
+    var piece = [];
+    var length = 1 + Random(i % 3 == 0 ? 4 : 20);
+    for (var j = 0; j < length; j++) {
+      piece.push(alphabet[Random(alphabet.length)]);
+    }
+    piece = piece.join("");
+    if (Random(2)) {
+      rope = rope + piece;
+      pieces.push(piece);
+    } else {
+      rope = piece + rope;
+      pieces.unshift(piece);
+    }
+  }
+  return {rope: rope, flat: pieces.join("")};
+}
+
+var alphabets = [["a", "b"], ["a", "b", "€"], ["a", "ab", "b", "ä"]];
+
+for (var a = 0; a < alphabets.length; a++) {
+  for (var k = 0; k < 20; k++) {
+    var strings = Rope(alphabets[a], 50);
+    var rope = strings.rope;
+    var flat = strings.flat;
+    for (var length = 1; length < 12; length++) {
+      var start = Random(flat.length - length);
+      var pattern = flat.substring(start, start + length);
+      var expected = NaiveIndexOf(flat, pattern);
+      assertEquals(expected, rope.indexOf(pattern), pattern);
+      assertEquals(expected, new RegExp(pattern).exec(rope).index, pattern);
+    }
+    assertEquals(-1, rope.indexOf("c"));
+    assertEquals(-1, rope.indexOf("a€€€€€€€€b"));
+    assertFalse(/ac/.test(rope));
+    assertTrue(rope == flat);
+    assertTrue(rope == Rope(alphabets[a], 0).rope + flat);
+    assertFalse(rope == flat.substring(1) + "c");
+  }
+}
+
+// A match which spans many short leaves.
+var short_leaves = "";
+for (var i = 0; i < 100; i++) short_leaves += String.fromCharCode(65 + i % 26);
+var long_pattern = short_leaves.substring(3, 60).split("").join("");
+assertEquals(3, short_leaves.indexOf(long_pattern));
+assertEquals(-1, short_leaves.indexOf(long_pattern + "!"));
@@ -112,6 +112,33 @@ TEST_F(JSIntrinsicLoweringTest, InlineOptimizedDoubleHi) {
 }
 
 
+// -----------------------------------------------------------------------------
+// %_HasFastPackedElements
+
+
+TEST_F(JSIntrinsicLoweringTest, InlineHasFastPackedElements) {
+  Node* const input = Parameter(0);
+  Node* const context = Parameter(1);
+  Node* const effect = graph()->start();
+  Node* const control = graph()->start();
+  Reduction const r = Reduce(graph()->NewNode(
+      javascript()->CallRuntime(Runtime::kInlineHasFastPackedElements, 1),
+      input, context, effect, control));
+  ASSERT_TRUE(r.Changed());
+
+  Node* phi = r.replacement();
+  Capture<Node*> branch, if_false;
+  EXPECT_THAT(
+      phi,
+      IsPhi(
+          MachineRepresentation::kTagged, IsFalseConstant(),
+          IsWord32Equal(_, IsInt32Constant(0)),
+          IsMerge(IsIfTrue(AllOf(CaptureEq(&branch),
+                                 IsBranch(IsObjectIsSmi(input), control))),
+                  AllOf(CaptureEq(&if_false), IsIfFalse(CaptureEq(&branch))))));
+}
+
+
 // -----------------------------------------------------------------------------
 // %_IsSmi
 
@@ -129,6 +156,25 @@ TEST_F(JSIntrinsicLoweringTest, InlineIsSmi) {
 }
 
 
+// -----------------------------------------------------------------------------
+// %_JSCollectionGetTable
+
+
+TEST_F(JSIntrinsicLoweringTest, InlineJSCollectionGetTable) {
+  Node* const input = Parameter(0);
+  Node* const context = Parameter(1);
+  Node* const effect = graph()->start();
+  Node* const control = graph()->start();
+  Reduction const r = Reduce(graph()->NewNode(
+      javascript()->CallRuntime(Runtime::kInlineJSCollectionGetTable, 1),
+      input, context, effect, control));
+  ASSERT_TRUE(r.Changed());
+  EXPECT_THAT(r.replacement(),
+              IsLoadField(AccessBuilder::ForJSCollectionTable(), input, effect,
+                          control));
+}
+
+
 // -----------------------------------------------------------------------------
 // %_IsArray
 
@@ -0,0 +1,139 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <cstdio>
+#include <string>
+
+#include "src/base/platform/elapsed-timer.h"
+#include "src/base/smart-pointers.h"
+#include "src/parsing/scanner.h"
+#include "src/parsing/scanner-character-streams.h"
+#include "src/unicode-cache.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Long enough to cross the buffer boundaries of the character streams.
+const int kLongLength = 3000;
+
+class ScannerTest : public ::testing::Test {
+ protected:
+  void Initialize(const std::string& source) {
+    source_ = source;
+    stream_.Reset(new Utf8ToUtf16CharacterStream(
+        reinterpret_cast<const byte*>(source_.data()), source_.length()));
+    scanner_.Reset(new Scanner(&unicode_cache_));
+    scanner_->Initialize(stream_.get());
+  }
+
+  Scanner* scanner() { return scanner_.get(); }
+
+  void ExpectLiteral(Token::Value token, const std::string& literal) {
+    EXPECT_EQ(token, scanner()->Next());
+    EXPECT_TRUE(scanner()->LiteralMatches(literal.data(),
+                                          static_cast<int>(literal.length())));
+  }
+
+ private:
+  UnicodeCache unicode_cache_;
+  std::string source_;
+  base::SmartPointer<Utf16CharacterStream> stream_;
+  base::SmartPointer<Scanner> scanner_;
+};
+
+
+std::string Repeat(const std::string& unit, int length) {
+  std::string result;
+  while (static_cast<int>(result.length()) < length) result += unit;
+  return result;
+}
+
+}  // namespace
+
+
+TEST_F(ScannerTest, LongIdentifiers) {
+  std::string lower = Repeat("abc_$09XYZ", kLongLength);
+  std::string upper = Repeat("Abc_$09xyz", kLongLength);
+  Initialize(lower + " " + upper + "\\u0041" + lower + ";");
+  ExpectLiteral(Token::IDENTIFIER, lower);
+  ExpectLiteral(Token::IDENTIFIER, upper + "A" + lower);
+  EXPECT_EQ(Token::SEMICOLON, scanner()->Next());
+  EXPECT_EQ(Token::EOS, scanner()->Next());
+}
+
+
+TEST_F(ScannerTest, LongStrings) {
+  std::string plain = Repeat("abc def 0123456789 '`~!@#$%^&*()", kLongLength);
+  std::string single = Repeat("abc \"xyz\" ", kLongLength);
+  Initialize("\"" + plain + "\" '" + single + "' \"" + plain + "\\n" + plain +
+             "\" \"" + plain + "\xc3\xa4" + plain + "\"");
+  ExpectLiteral(Token::STRING, plain);
+  ExpectLiteral(Token::STRING, single);
+  ExpectLiteral(Token::STRING, plain + "\n" + plain);
+  EXPECT_EQ(Token::STRING, scanner()->Next());
+  EXPECT_EQ(Token::EOS, scanner()->Next());
+}
+
+
+TEST_F(ScannerTest, UnterminatedLongString) {
+  Initialize("\"" + Repeat("abcdefgh", kLongLength) + "\nx\"");
+  EXPECT_EQ(Token::ILLEGAL, scanner()->Next());
+}
+
+
+TEST_F(ScannerTest, LongComments) {
+  std::string text = Repeat("text / with * stars and slashes ", kLongLength);
+  Initialize("a //" + text + "\nb /*" + text + "*/ c /*" + text + "\r\n" +
+             text + "*/ d" + Repeat(" \t", kLongLength) + "e");
+  ExpectLiteral(Token::IDENTIFIER, "a");
+  ExpectLiteral(Token::IDENTIFIER, "b");
+  EXPECT_TRUE(scanner()->HasAnyLineTerminatorBeforeNext());
+  ExpectLiteral(Token::IDENTIFIER, "c");
+  EXPECT_FALSE(scanner()->HasAnyLineTerminatorBeforeNext());
+  ExpectLiteral(Token::IDENTIFIER, "d");
+  EXPECT_TRUE(scanner()->HasAnyLineTerminatorBeforeNext());
+  ExpectLiteral(Token::IDENTIFIER, "e");
+  EXPECT_FALSE(scanner()->HasAnyLineTerminatorBeforeNext());
+  EXPECT_EQ(Token::EOS, scanner()->Next());
+}
+
+
+TEST_F(ScannerTest, CommentWithUnicodeLineTerminator) {
+  // U+2028 LINE SEPARATOR terminates single line comments.
+  Initialize("a //" + Repeat("comment ", kLongLength) + "\xe2\x80\xa8" + "b");
+  ExpectLiteral(Token::IDENTIFIER, "a");
+  ExpectLiteral(Token::IDENTIFIER, "b");
+  EXPECT_TRUE(scanner()->HasAnyLineTerminatorBeforeNext());
+  EXPECT_EQ(Token::EOS, scanner()->Next());
+}
+
+
+// Throughput microbenchmark for the scanner's block-scanning fast paths. Run
+// with --gtest_also_run_disabled_tests.
+TEST_F(ScannerTest, DISABLED_Throughput) {
+  std::string source;
+  for (int i = 0; i < 20000; i++) {
+    source += "  // A single line comment describing the code below.\n";
+    source += "  /* A multi-line comment\n     spanning two lines. */\n";
+    source += "  var someLongerIdentifierName = \"a string literal value\";\n";
+    source += "  SomeConstructor.prototype.method_name = 'another string';\n";
+  }
+  base::ElapsedTimer timer;
+  timer.Start();
+  int tokens = 0;
+  for (int i = 0; i < 10; i++) {
+    Initialize(source);
+    while (scanner()->Next() != Token::EOS) tokens++;
+  }
+  double ms = timer.Elapsed().InMillisecondsF();
+  printf("Scanned %d tokens (%d bytes) in %.3f ms, %.1f MB/s\n", tokens,
+         static_cast<int>(source.length() * 10), ms,
+         source.length() * 10 / (ms * 1000.0));
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -490,6 +490,8 @@
         '../../src/ast/variables.cc',
         '../../src/ast/variables.h',
         '../../src/atomic-utils.h',
+        '../../src/background-deserialization-task.cc',
+        '../../src/background-deserialization-task.h',
         '../../src/background-parsing-task.cc',
         '../../src/background-parsing-task.h',
         '../../src/bailout-reason.cc',
@@ -519,6 +521,7 @@
         '../../src/code-stubs.cc',
         '../../src/code-stubs.h',
         '../../src/code-stubs-hydrogen.cc',
+        '../../src/code-unit-word.h',
         '../../src/codegen.cc',
         '../../src/codegen.h',
         '../../src/compilation-cache.cc',
@@ -954,8 +957,12 @@
         '../../src/isolate-inl.h',
         '../../src/isolate.cc',
         '../../src/isolate.h',
+        '../../src/json-parser.cc',
         '../../src/json-parser.h',
+        '../../src/json-stringifier.cc',
         '../../src/json-stringifier.h',
+        '../../src/json-tape.cc',
+        '../../src/json-tape.h',
         '../../src/key-accumulator.h',
         '../../src/key-accumulator.cc',
         '../../src/layout-descriptor-inl.h',
@@ -1057,6 +1064,8 @@
         '../../src/regexp/regexp-macro-assembler-tracer.h',
         '../../src/regexp/regexp-macro-assembler.cc',
         '../../src/regexp/regexp-macro-assembler.h',
+        '../../src/regexp/regexp-nfa.cc',
+        '../../src/regexp/regexp-nfa.h',
         '../../src/regexp/regexp-parser.cc',
         '../../src/regexp/regexp-parser.h',
         '../../src/regexp/regexp-stack.cc',